@@ -0,0 +1,139 @@
+//--------------------------------------------------
+// Implementation of class ARFFBulkReader
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "ARFFBulkReader.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Custom Constructor
+ * @param path The path to the file that we are loading
+ * @param threads The number of threads used for parsing (0 uses the OpenCV thread count, 1 parses serially)
+ */
+ARFFBulkReader::ARFFBulkReader(const string& path, int threads) : _threads(threads)
+{
+	_file = new MappedFile(path);
+
+	// The header is small, so it is handed to the existing header parser as a stream
+	_dataStart = ARFFParser::FindDataStart(_file->GetData(), _file->GetEnd());
+	auto headerText = istringstream(string(_file->GetData(), _dataStart));
+	_header = new ARFFHeader(headerText);
+
+	// Determine the expected column count
+	_columns = _header->GetFields().size();
+	if (_header->GetHasOutput()) _columns++;
+	if (_header->GetClassLabels().size() > 0) _columns++;
+
+	// Load in class labels for later verification
+	_classes = ARFFClassSet(_header->GetClassLabels());
+}
+
+/**
+ * @brief Main Terminator
+ */
+ARFFBulkReader::~ARFFBulkReader()
+{
+	delete _header; delete _file;
+}
+
+//--------------------------------------------------
+// Read
+//--------------------------------------------------
+
+/**
+ * @brief Read all the data within the file
+ * @return Mat The data (one row per record)
+ * @remark Rows are counted per chunk first, so the result is allocated once and each chunk parses straight into its own rows.
+ * The ROW_COUNT header is not relied on, as older writers did not fill it in correctly.
+ */
+Mat ARFFBulkReader::ReadAll()
+{
+	auto boundaries = vector<const char *>(); GetChunks(boundaries);
+	auto chunkCount = (int)boundaries.size() - 1;
+
+	// Count the rows within each chunk
+	auto counts = vector<int>(chunkCount);
+	parallel_for_(Range(0, chunkCount), [&](const Range& range)
+	{
+		for (auto chunk = range.start; chunk < range.end; chunk++) counts[chunk] = ARFFParser::CountRows(boundaries[chunk], boundaries[chunk + 1]);
+	});
+
+	auto offsets = vector<int>(chunkCount + 1, 0);
+	for (auto chunk = 0; chunk < chunkCount; chunk++) offsets[chunk + 1] = offsets[chunk] + counts[chunk];
+	if (offsets[chunkCount] == 0) return Mat();
+
+	// Parse each chunk into its rows of the result (errors are held per chunk, as parallel_for_ would rethrow them as cv::Exception)
+	Mat result = Mat_<double>(offsets[chunkCount], _columns);
+	auto errors = vector<exception_ptr>(chunkCount);
+	parallel_for_(Range(0, chunkCount), [&](const Range& range)
+	{
+		for (auto chunk = range.start; chunk < range.end; chunk++)
+		{
+			try { ParseChunk(boundaries[chunk], boundaries[chunk + 1], result, offsets[chunk]); }
+			catch (...) { errors[chunk] = current_exception(); }
+		}
+	});
+
+	for (auto& error : errors) if (error) rethrow_exception(error);
+
+	return result;
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Split the data section into line-aligned chunks
+ * @param boundaries The output chunk boundaries (chunk i is [boundaries[i], boundaries[i + 1]))
+ */
+void ARFFBulkReader::GetChunks(vector<const char *>& boundaries)
+{
+	auto threads = _threads > 0 ? _threads : std::max(1, cv::getNumThreads());
+	auto chunkCount = threads == 1 ? 1 : threads * 4;
+
+	auto begin = _dataStart; auto end = _file->GetEnd();
+	auto size = (size_t)(end - begin);
+
+	boundaries.clear(); boundaries.push_back(begin);
+	for (auto chunk = 1; chunk < chunkCount; chunk++)
+	{
+		auto position = ARFFParser::FindLineStart(begin, end, begin + size * chunk / chunkCount);
+		if (position > boundaries.back()) boundaries.push_back(position);
+	}
+	if (boundaries.back() != end) boundaries.push_back(end);
+	if (boundaries.size() == 1) boundaries.push_back(end);
+}
+
+/**
+ * @brief Parse a line-aligned chunk into the result
+ * @param begin The start of the chunk
+ * @param end The end of the chunk
+ * @param output The result matrix
+ * @param startRow The first row that belongs to this chunk
+ */
+void ARFFBulkReader::ParseChunk(const char * begin, const char * end, Mat& output, int startRow)
+{
+	auto row = startRow; auto line = begin;
+
+	while (line < end)
+	{
+		auto next = (const char *) memchr(line, '\n', end - line);
+		auto lineEnd = next == nullptr ? end : next;
+		if (ARFFParser::IsBlankLine(line, lineEnd)) { line = lineEnd + 1; continue; }
+
+		auto data = output.ptr<double>(row++);
+		line = ARFFParser::ParseRow(line, end, data, _columns);
+
+		// Verify the classes
+		if (!_classes.IsEmpty() && _classes.GetIndex(data[_columns - 1]) < 0) throw runtime_error("The field lables do not seem to match the header");
+	}
+}
@@ -0,0 +1,50 @@
+//--------------------------------------------------
+// Reads the whole of an ARFF file into a single matrix (memory mapped, parsed in parallel)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <sstream>
+#include <exception>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "ARFFHeader.h"
+#include "ARFFParser.h"
+#include "ARFFClassSet.h"
+#include "MappedFile.h"
+
+namespace NVLib
+{
+	class ARFFBulkReader
+	{
+	private:
+		MappedFile * _file;
+		ARFFHeader * _header;
+		int _columns;
+		int _threads;
+		ARFFClassSet _classes;
+		const char * _dataStart;
+	public:
+		ARFFBulkReader(const string& path, int threads = 0);
+		~ARFFBulkReader();
+
+		Mat ReadAll();
+
+		inline ARFFHeader * GetHeader() { return _header; }
+		inline MappedFile * GetFile() { return _file; }
+		inline string GetHeaderText() { return string(_file->GetData(), _dataStart); }
+		inline int GetColumns() { return _columns; }
+		inline int& GetThreads() { return _threads; }
+	private:
+		void GetChunks(vector<const char *>& boundaries);
+		void ParseChunk(const char * begin, const char * end, Mat& output, int startRow);
+	};
+}
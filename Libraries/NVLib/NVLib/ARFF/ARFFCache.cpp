@@ -0,0 +1,240 @@
+//--------------------------------------------------
+// Implementation of class ARFFCache
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "ARFFCache.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Custom Constructor
+ * @param path The path to the ARFF file
+ * @param layout The layout of the cached data (LAYOUT_ROW_MAJOR or LAYOUT_COLUMN_MAJOR)
+ * @param depth The element type of the cached data (CV_64F or CV_32F)
+ * @param threads The number of threads used if the source needs to be parsed
+ * @remark Column major data is returned with one row per attribute. The data is only valid while the cache object is alive,
+ * and writes to it never reach the sidecar (the mapping is copy-on-write).
+ */
+ARFFCache::ARFFCache(const string& path, int layout, int depth, int threads) : _path(path), _layout(layout), _depth(depth)
+{
+	if (layout != LAYOUT_ROW_MAJOR && layout != LAYOUT_COLUMN_MAJOR) throw runtime_error("Unknown ARFF cache layout");
+	if (depth != CV_64F && depth != CV_32F) throw runtime_error("The ARFF cache only supports CV_64F and CV_32F data");
+
+	_cachePath = GetCachePath(path); _file = nullptr; _header = nullptr; _rebuilt = false;
+
+	if (Open()) return;
+
+	Build(threads); _rebuilt = true;
+}
+
+/**
+ * @brief Main Terminator
+ */
+ARFFCache::~ARFFCache()
+{
+	_data.release();
+	if (_header != nullptr) delete _header;
+	if (_file != nullptr) delete _file;
+}
+
+//--------------------------------------------------
+// Paths and Hashing
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the path of the sidecar for a given ARFF file
+ * @param path The path to the ARFF file
+ * @return string The path to the sidecar
+ */
+string ARFFCache::GetCachePath(const string& path)
+{
+	return path + EXTENSION;
+}
+
+/**
+ * @brief Calculate a 64-bit FNV-1a hash of a block of memory
+ * @param data The data being hashed
+ * @param size The size of the data
+ * @return uint64_t The resultant hash
+ */
+uint64_t ARFFCache::GetHash(const char * data, size_t size)
+{
+	auto result = (uint64_t)14695981039346656037ULL;
+
+	for (size_t i = 0; i < size; i++)
+	{
+		result ^= (uint8_t)data[i];
+		result *= 1099511628211ULL;
+	}
+
+	return result;
+}
+
+//--------------------------------------------------
+// Open
+//--------------------------------------------------
+
+/**
+ * @brief Attempt to open an existing sidecar
+ * @return true The sidecar was valid and has been mapped
+ * @return false The sidecar is missing, stale or does not match the requested layout
+ * @remark The source is only hashed if its size matches but its modification time does not
+ */
+bool ARFFCache::Open()
+{
+	if (!filesystem::exists(_cachePath)) return false;
+
+	// The mapping is copy-on-write, so callers may modify the returned data without touching the sidecar
+	auto file = unique_ptr<MappedFile>(new MappedFile(_cachePath, true));
+	if (file->GetSize() < sizeof(CacheHeader)) return false;
+
+	auto header = CacheHeader(); memcpy(&header, file->GetData(), sizeof(CacheHeader));
+
+	auto elementSize = _depth == CV_64F ? sizeof(double) : sizeof(float);
+	auto valid = memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 && header.version == VERSION;
+	valid = valid && header.layout == (uint32_t)_layout && header.depth == (uint32_t)_depth;
+	valid = valid && header.dataOffset >= sizeof(CacheHeader) && header.headerLength <= header.dataOffset - sizeof(CacheHeader);
+	valid = valid && header.dataOffset <= file->GetSize() && IsDataInBounds(header, elementSize, file->GetSize() - header.dataOffset);
+	valid = valid && header.sourceSize == (uint64_t)filesystem::file_size(_path);
+
+	auto sourceTime = GetSourceTime(_path); auto touched = valid && header.sourceTime != sourceTime;
+
+	if (touched)
+	{
+		auto source = MappedFile(_path);
+		valid = header.sourceHash == GetHash(source.GetData(), source.GetSize());
+	}
+
+	if (!valid) return false;
+
+	// The content is unchanged, so record the new time to avoid hashing the source on every open
+	if (touched) UpdateSourceTime(sourceTime);
+
+	// Rebuild the header from the original header text
+	auto headerText = istringstream(string(file->GetData() + sizeof(CacheHeader), header.headerLength));
+	_header = new ARFFHeader(headerText);
+
+	// Wrap the mapped data without copying it
+	auto data = (void *) (file->GetData() + header.dataOffset);
+	if (_layout == LAYOUT_ROW_MAJOR) _data = Mat((int)header.rows, (int)header.columns, _depth, data);
+	else _data = Mat((int)header.columns, (int)header.rows, _depth, data);
+
+	_file = file.release();
+
+	return true;
+}
+
+//--------------------------------------------------
+// Build
+//--------------------------------------------------
+
+/**
+ * @brief Parse the source file and write a new sidecar
+ * @param threads The number of threads used for parsing
+ */
+void ARFFCache::Build(int threads)
+{
+	auto reader = ARFFBulkReader(_path, threads);
+	Mat data = reader.ReadAll();
+
+	if (_depth != CV_64F) data.convertTo(data, _depth);
+	if (_layout == LAYOUT_COLUMN_MAJOR) data = data.t();
+
+	auto headerText = reader.GetHeaderText();
+	auto hash = GetHash(reader.GetFile()->GetData(), reader.GetFile()->GetSize());
+
+	Write(headerText, data, hash);
+
+	auto stream = istringstream(headerText);
+	_header = new ARFFHeader(stream);
+	_data = data;
+}
+
+/**
+ * @brief Write the sidecar to disk
+ * @param headerText The original header text
+ * @param data The data in its final layout and type
+ * @param sourceHash The hash of the source file
+ * @remark The sidecar is written to a temporary file and renamed, so a reader never sees a partial file
+ */
+void ARFFCache::Write(const string& headerText, Mat& data, uint64_t sourceHash)
+{
+	auto rows = _layout == LAYOUT_ROW_MAJOR ? data.rows : data.cols;
+	auto columns = _layout == LAYOUT_ROW_MAJOR ? data.cols : data.rows;
+
+	auto header = CacheHeader(); memset(&header, 0, sizeof(CacheHeader));
+	memcpy(header.magic, MAGIC, sizeof(MAGIC));
+	header.version = VERSION; header.layout = _layout; header.depth = _depth;
+	header.sourceSize = filesystem::file_size(_path); header.sourceTime = GetSourceTime(_path); header.sourceHash = sourceHash;
+	header.rows = rows; header.columns = columns; header.headerLength = headerText.size();
+
+	// Align the data so that it can be used directly from the mapping
+	auto offset = sizeof(CacheHeader) + headerText.size();
+	header.dataOffset = (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+
+	auto tempPath = _cachePath + ".tmp";
+	auto writer = ofstream(tempPath, ios::binary);
+	if (!writer.is_open()) throw runtime_error("Unable to create the ARFF cache: " + tempPath);
+
+	writer.write((const char *) &header, sizeof(CacheHeader));
+	writer.write(headerText.data(), headerText.size());
+	auto padding = string(header.dataOffset - offset, '\0'); writer.write(padding.data(), padding.size());
+
+	Mat continuous = data.isContinuous() ? data : data.clone();
+	writer.write((const char *) continuous.data, continuous.total() * continuous.elemSize());
+	writer.close();
+
+	if (!writer) throw runtime_error("Failed to write the ARFF cache: " + tempPath);
+	filesystem::rename(tempPath, _cachePath);
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Overwrite the source time that is stored in the sidecar header
+ * @param sourceTime The new modification time of the source
+ * @remark This is best effort: if the sidecar can't be written the source is just hashed again on the next open
+ */
+void ARFFCache::UpdateSourceTime(int64_t sourceTime)
+{
+	auto writer = fstream(_cachePath, ios::in | ios::out | ios::binary);
+	if (!writer.is_open()) return;
+
+	writer.seekp(offsetof(CacheHeader, sourceTime));
+	writer.write((const char *) &sourceTime, sizeof(sourceTime));
+}
+
+/**
+ * @brief Retrieve the modification time of a file as a tick count
+ * @param path The path to the file
+ * @return int64_t The modification time
+ */
+int64_t ARFFCache::GetSourceTime(const string& path)
+{
+	return (int64_t) filesystem::last_write_time(path).time_since_epoch().count();
+}
+
+/**
+ * @brief Check that the data described by a sidecar header fits within the mapped file
+ * @param header The header that we are checking
+ * @param elementSize The size of a single element
+ * @param available The number of bytes after the data offset
+ * @return true The dimensions fit in a Mat and the data lies within the file
+ * @return false The dimensions are too large (the checks are written so that they can't overflow)
+ */
+bool ARFFCache::IsDataInBounds(const CacheHeader& header, size_t elementSize, uint64_t available)
+{
+	auto limit = (uint64_t)numeric_limits<int>::max();
+	if (header.rows > limit || header.columns > limit) return false;
+	if (header.rows == 0 || header.columns == 0) return true;
+	return header.rows <= available / (header.columns * elementSize);
+}
@@ -0,0 +1,95 @@
+//--------------------------------------------------
+// A binary sidecar cache of an ARFF file's data (memory mapped on subsequent opens)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+#include <filesystem>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "ARFFHeader.h"
+#include "ARFFBulkReader.h"
+#include "MappedFile.h"
+
+namespace NVLib
+{
+	class ARFFCache
+	{
+	public:
+
+		/* Constant: the layouts that the data can be stored in */
+		inline static const int LAYOUT_ROW_MAJOR = 0;
+		inline static const int LAYOUT_COLUMN_MAJOR = 1;
+
+	private:
+
+		/* Constant */
+		inline static const char MAGIC[8] = { 'N', 'V', 'A', 'R', 'F', 'F', 'C', 'A' };
+		inline static const uint32_t VERSION = 1;
+		inline static const size_t ALIGNMENT = 64;
+		inline static const string EXTENSION = ".cache";
+
+		struct CacheHeader
+		{
+			char magic[8];
+			uint32_t version;
+			uint32_t layout;
+			uint32_t depth;
+			uint32_t reserved;
+			uint64_t sourceSize;
+			int64_t sourceTime;
+			uint64_t sourceHash;
+			uint64_t rows;
+			uint64_t columns;
+			uint64_t headerLength;
+			uint64_t dataOffset;
+		};
+
+	private:
+		string _path;
+		string _cachePath;
+		int _layout;
+		int _depth;
+		MappedFile * _file;
+		ARFFHeader * _header;
+		Mat _data;
+		bool _rebuilt;
+	public:
+		ARFFCache(const string& path, int layout = LAYOUT_ROW_MAJOR, int depth = CV_64F, int threads = 0);
+		~ARFFCache();
+
+		ARFFCache(const ARFFCache&) = delete;
+		ARFFCache& operator=(const ARFFCache&) = delete;
+
+		static string GetCachePath(const string& path);
+		static uint64_t GetHash(const char * data, size_t size);
+
+		inline Mat& GetData() { return _data; }
+		inline ARFFHeader * GetHeader() { return _header; }
+		inline bool GetRebuilt() { return _rebuilt; }
+		inline string& GetPath() { return _path; }
+		inline int GetLayout() { return _layout; }
+		inline int GetDepth() { return _depth; }
+	private:
+		bool Open();
+		void Build(int threads);
+		void Write(const string& headerText, Mat& data, uint64_t sourceHash);
+		void UpdateSourceTime(int64_t sourceTime);
+		static int64_t GetSourceTime(const string& path);
+		static bool IsDataInBounds(const CacheHeader& header, size_t elementSize, uint64_t available);
+	};
+}
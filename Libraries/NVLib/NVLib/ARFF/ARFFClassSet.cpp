@@ -0,0 +1,79 @@
+//--------------------------------------------------
+// Implementation of class ARFFClassSet
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "ARFFClassSet.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Constructors
+//--------------------------------------------------
+
+/**
+ * @brief Default Constructor (an empty set)
+ */
+ARFFClassSet::ARFFClassSet() : _min(0), _dense(true)
+{
+	// Extra implementation can go here
+}
+
+/**
+ * @brief Main Constructor
+ * @param labels The class labels from the header
+ * @remark Compact label ranges get a dense table (a single subtraction per lookup), while sparse
+ * labels fall back to a binary search so that something like {0, 1000000000} doesn't allocate a huge table
+ */
+ARFFClassSet::ARFFClassSet(const vector<int>& labels) : _min(0), _dense(true)
+{
+	_labels = labels; sort(_labels.begin(), _labels.end());
+	_labels.erase(unique(_labels.begin(), _labels.end()), _labels.end());
+	if (_labels.empty()) return;
+
+	_min = _labels.front();
+	auto span = (int64_t)_labels.back() - (int64_t)_min + 1;
+	_dense = span <= DENSE_FACTOR * (int64_t)_labels.size();
+
+	if (!_dense) return;
+
+	_valid.assign((size_t)span, 0);
+	for (auto label : _labels) _valid[(int64_t)label - _min] = 1;
+}
+
+//--------------------------------------------------
+// Lookup
+//--------------------------------------------------
+
+/**
+ * @brief Find the position of a label within the set
+ * @param label The label that we are looking up
+ * @return int The index (between 0 and GetSize() - 1), or -1 if the label is not a class label
+ */
+int ARFFClassSet::GetIndex(int label) const
+{
+	if (_dense)
+	{
+		auto index = (int64_t)label - _min;
+		if (index < 0 || index >= (int64_t)_valid.size() || !_valid[index]) return -1;
+		return (int)index;
+	}
+
+	auto position = lower_bound(_labels.begin(), _labels.end(), label);
+	if (position == _labels.end() || *position != label) return -1;
+	return (int)(position - _labels.begin());
+}
+
+/**
+ * @brief Find the position of a label that was read as a floating point value
+ * @param value The value that we are looking up (truncated to an integer, as before)
+ * @return int The index (between 0 and GetSize() - 1), or -1 if the value is not a class label
+ * @remark NaN and values outside the int range are rejected before the cast, which would otherwise be undefined
+ */
+int ARFFClassSet::GetIndex(double value) const
+{
+	if (!(value > (double)INT32_MIN - 1.0 && value < (double)INT32_MAX + 1.0)) return -1;
+	return GetIndex((int)value);
+}
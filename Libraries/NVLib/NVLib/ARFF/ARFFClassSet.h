@@ -0,0 +1,42 @@
+//--------------------------------------------------
+// A lookup of the class labels of an ARFF file (used to validate and filter rows)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <iostream>
+using namespace std;
+
+namespace NVLib
+{
+	class ARFFClassSet
+	{
+	private:
+
+		/* Constant: a dense table is used while the label span is at most this multiple of the label count */
+		inline static const int64_t DENSE_FACTOR = 4;
+
+	private:
+		int _min;
+		bool _dense;
+		vector<uint8_t> _valid;
+		vector<int> _labels;
+	public:
+		ARFFClassSet();
+		ARFFClassSet(const vector<int>& labels);
+
+		int GetIndex(int label) const;
+		int GetIndex(double value) const;
+
+		inline int GetSize() const { return _dense ? (int)_valid.size() : (int)_labels.size(); }
+		inline bool IsEmpty() const { return _labels.empty(); }
+		inline bool IsDense() const { return _dense; }
+	};
+}
@@ -61,12 +61,31 @@ ARFFHeader::ARFFHeader(const string& dataName, const string& author, int recordC
  */
 void ARFFHeader::Save(ostream& writer)
 {
+	Save(writer, false);
+}
+
+/**
+ * @brief Save the header to disk, optionally reserving space for the row count
+ * @param writer The stream that we are writing the output to
+ * @param reserveRowCount Always write a fixed width row count so that it can be patched once the data is written
+ * @return streamoff The offset of the row count value from the start of the header (-1 if it was not reserved)
+ */
+streamoff ARFFHeader::Save(ostream& writer, bool reserveRowCount)
+{
+	auto start = writer.tellp(); streamoff rowCountOffset = -1;
+
 	writer << "%----------------------------------------------------" << endl;
-	if (_description != string()) writer << "% @ABOUT " << _description << endl;
+	if (_description != string()) writer << PREFIX_DESCRIPTION << _description << endl;
 	writer << "%" << endl;
-	if (_author != string()) writer << "% @AUTHOR " << _author << endl;
-	if (_created != string()) writer << "% @CREATED " << _created << endl;
-	if (_recordCount > 0) writer << "% @ROW_COUNT 22" << endl;
+	if (_author != string()) writer << PREFIX_AUTHOR << _author << endl;
+	if (_created != string()) writer << PREFIX_CREATED << _created << endl;
+	if (reserveRowCount)
+	{
+		writer << PREFIX_ROW_COUNT << " ";
+		rowCountOffset = writer.tellp() - start;
+		writer << FormatRowCount(std::max(_recordCount, 0)) << endl;
+	}
+	else if (_recordCount > 0) writer << PREFIX_ROW_COUNT << " " << _recordCount << endl;
 	writer << "%----------------------------------------------------" << endl;
 
 	writer << "@RELATION " << _dataName << endl << endl;
@@ -90,6 +109,20 @@ void ARFFHeader::Save(ostream& writer)
 	}
 
 	writer << endl << "@DATA" << endl;
+
+	return rowCountOffset;
+}
+
+/**
+ * @brief Format a row count so that it always takes up the same number of characters
+ * @param count The count that we are formatting
+ * @return string The count, right aligned within the reserved width
+ */
+string ARFFHeader::FormatRowCount(int count)
+{
+	auto result = to_string(count);
+	if ((int)result.size() > ROW_COUNT_WIDTH) throw runtime_error("The row count is too large for the reserved space");
+	return string(ROW_COUNT_WIDTH - result.size(), ' ') + result;
 }
 
 //--------------------------------------------------
@@ -164,9 +197,9 @@ void ARFFHeader::ReadRecordCount(const string& line)
  */
 void ARFFHeader::ReadAttribute(const string& line) 
 {
-	auto parts = vector<string>(); StringUtils::Split(line, ' ', parts);
+	auto parts = vector<string_view>(); StringUtils::Split(line, ' ', parts);
 	if (parts.size() != 3) throw runtime_error("Attribute syntax appears to be incorrect within the file");
-	_fields.push_back(parts[1]);
+	_fields.push_back(string(parts[1]));
 }
 
 /**
@@ -184,20 +217,13 @@ void ARFFHeader::ReadOutputFound(const string& line)
  */
 void ARFFHeader::ReadClassEntry(const string& line)
 {
-	// Create a variable for holding the class list
-	auto classList = stringstream();
-
 	// Extract the class list from the line
-	bool startFound = false;
-	for (auto& character : line) 
-	{
-		if (startFound && character == '}') break;
-		else if (!startFound && character == '{') startFound = true;
-		else if (startFound) classList << character;
-	}
+	auto start = line.find('{'); if (start == string::npos) return;
+	auto end = line.find('}', start + 1); if (end == string::npos) end = line.size();
+	auto classList = string_view(line).substr(start + 1, end - start - 1);
 
 	// Break the classList into parts
-	auto parts = vector<string>(); StringUtils::Split(classList.str(), ',', parts);
+	auto parts = vector<string_view>(); StringUtils::Split(classList, ',', parts);
 
 	// Add the parts to the class
 	for (auto& part : parts) 
@@ -30,6 +30,7 @@ namespace NVLib
 		inline static const string PREFIX_CLASS = "@ATTRIBUTE class ";
 		inline static const string PREFIX_OUTPUT = "@ATTRIBUTE output ";
 		inline static const string PREFIX_ATTRIBUTE = "@ATTRIBUTE";
+		inline static const int ROW_COUNT_WIDTH = 12;
 	
 	private:
 		string _dataName;
@@ -45,6 +46,9 @@ namespace NVLib
 		ARFFHeader(const string& dataName, const string& author, int recordCount = -1);
 
 		void Save(ostream& writer);
+		streamoff Save(ostream& writer, bool reserveRowCount);
+
+		static string FormatRowCount(int count);
 
 		inline string& GetDescription() { return _description; }
 		inline string& GetDataName() { return _dataName; }
@@ -0,0 +1,185 @@
+//--------------------------------------------------
+// Implementation of class ARFFParser
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "ARFFParser.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Navigation
+//--------------------------------------------------
+
+/**
+ * @brief Move a position forward to the start of the next line (unless it is already at the start of one)
+ * @param begin The start of the buffer
+ * @param end The end of the buffer
+ * @param position The position that we are aligning
+ * @return const char * The aligned position
+ */
+const char * ARFFParser::FindLineStart(const char * begin, const char * end, const char * position)
+{
+	if (position <= begin) return begin;
+	if (position >= end) return end;
+	if (position[-1] == '\n') return position;
+
+	auto match = (const char *) memchr(position, '\n', end - position);
+	return match == nullptr ? end : match + 1;
+}
+
+/**
+ * @brief Find the first character after the @DATA line
+ * @param begin The start of the buffer
+ * @param end The end of the buffer
+ * @return const char * The start of the data (end if there is no data section)
+ */
+const char * ARFFParser::FindDataStart(const char * begin, const char * end)
+{
+	auto line = begin;
+
+	while (line < end)
+	{
+		auto next = (const char *) memchr(line, '\n', end - line);
+		auto lineEnd = next == nullptr ? end : next;
+
+		if (lineEnd - line >= 5 && strncmp(line, "@DATA", 5) == 0) return next == nullptr ? end : next + 1;
+
+		line = lineEnd + 1;
+	}
+
+	return end;
+}
+
+/**
+ * @brief Count the number of (non-blank) rows within a line-aligned section
+ * @param begin The start of the section
+ * @param end The end of the section
+ * @return int The number of rows
+ */
+int ARFFParser::CountRows(const char * begin, const char * end)
+{
+	auto result = 0; auto line = begin;
+
+	while (line < end)
+	{
+		auto next = (const char *) memchr(line, '\n', end - line);
+		auto lineEnd = next == nullptr ? end : next;
+		if (!IsBlankLine(line, lineEnd)) result++;
+		line = lineEnd + 1;
+	}
+
+	return result;
+}
+
+//--------------------------------------------------
+// Parsing
+//--------------------------------------------------
+
+/**
+ * @brief Parse a single comma separated row of numbers
+ * @param begin The start of the row
+ * @param end The end of the buffer
+ * @param output The output values (columns entries)
+ * @param columns The number of expected values
+ * @return const char * The start of the next line
+ */
+const char * ARFFParser::ParseRow(const char * begin, const char * end, double * output, int columns)
+{
+	auto position = begin;
+
+	for (auto column = 0; column < columns; column++)
+	{
+		while (position < end && (*position == ' ' || *position == '\t')) position++;
+
+		// from_chars does not accept a leading '+'
+		if (position < end && *position == '+') position++;
+
+		auto result = from_chars(position, end, output[column]);
+		if (result.ec != errc()) throw runtime_error("Unable to parse a number within the ARFF data");
+		position = result.ptr;
+
+		while (position < end && (*position == ' ' || *position == '\t')) position++;
+
+		auto last = column == columns - 1;
+		if (!last && (position >= end || *position != ',')) throw runtime_error("The number of numbers dont seem to match the column count");
+		if (!last) position++;
+	}
+
+	// The rest of the line must be empty
+	while (position < end && (*position == ' ' || *position == '\t' || *position == '\r')) position++;
+	if (position < end && *position != '\n') throw runtime_error("The number of numbers dont seem to match the column count");
+
+	return position < end ? position + 1 : end;
+}
+
+/**
+ * @brief Parse only the selected fields of a comma separated row
+ * @param begin The start of the row
+ * @param end The end of the buffer
+ * @param targets The output index of each field in the row (-1 for fields that are skipped)
+ * @param output The output values
+ * @return const char * The start of the next line
+ * @remark Skipped fields are only scanned for the next delimiter, so they cost no conversion
+ */
+const char * ARFFParser::ParseFields(const char * begin, const char * end, const vector<int>& targets, double * output)
+{
+	auto next = (const char *) memchr(begin, '\n', end - begin);
+	auto lineEnd = next == nullptr ? end : next;
+
+	auto position = begin; auto columns = (int)targets.size();
+
+	for (auto column = 0; column < columns; column++)
+	{
+		auto delimiter = (const char *) memchr(position, ',', lineEnd - position);
+		auto fieldEnd = delimiter == nullptr ? lineEnd : delimiter;
+
+		auto last = column == columns - 1;
+		if (last != (fieldEnd == lineEnd)) throw runtime_error("The number of numbers dont seem to match the column count");
+
+		if (targets[column] >= 0) output[targets[column]] = ParseField(position, fieldEnd);
+		position = fieldEnd + 1;
+	}
+
+	return next == nullptr ? end : next + 1;
+}
+
+/**
+ * @brief Parse a single numeric field
+ * @param begin The start of the field
+ * @param end The end of the field (exclusive of the delimiter)
+ * @return double The value of the field
+ */
+double ARFFParser::ParseField(const char * begin, const char * end)
+{
+	auto position = begin;
+	while (position < end && (*position == ' ' || *position == '\t')) position++;
+	if (position < end && *position == '+') position++;
+
+	auto value = 0.0; auto result = from_chars(position, end, value);
+	if (result.ec != errc()) throw runtime_error("Unable to parse a number within the ARFF data");
+
+	for (position = result.ptr; position < end; position++)
+	{
+		if (*position != ' ' && *position != '\t' && *position != '\r') throw runtime_error("Unable to parse a number within the ARFF data");
+	}
+
+	return value;
+}
+
+/**
+ * @brief Determine whether a line only contains whitespace
+ * @param begin The start of the line
+ * @param end The end of the line (exclusive of the newline)
+ * @return true The line is blank
+ */
+bool ARFFParser::IsBlankLine(const char * begin, const char * end)
+{
+	for (auto position = begin; position < end; position++)
+	{
+		if (*position != ' ' && *position != '\t' && *position != '\r') return false;
+	}
+	return true;
+}
@@ -0,0 +1,30 @@
+//--------------------------------------------------
+// Low level helpers for parsing the data section of an ARFF file in memory
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <charconv>
+#include <cstring>
+#include <vector>
+#include <iostream>
+using namespace std;
+
+namespace NVLib
+{
+	class ARFFParser
+	{
+	public:
+		static const char * FindLineStart(const char * begin, const char * end, const char * position);
+		static const char * FindDataStart(const char * begin, const char * end);
+		static int CountRows(const char * begin, const char * end);
+		static const char * ParseRow(const char * begin, const char * end, double * output, int columns);
+		static const char * ParseFields(const char * begin, const char * end, const vector<int>& targets, double * output);
+		static double ParseField(const char * begin, const char * end);
+		static bool IsBlankLine(const char * begin, const char * end);
+	};
+}
@@ -31,8 +31,15 @@ ARFFReader::ARFFReader(const string& path)
 	if (_header->GetHasOutput()) _columns++;
 	if (_header->GetClassLabels().size() > 0) _columns++;
 
-	// Load in class labels for later verification
-	for (auto label : _header->GetClassLabels()) _classes.insert(label);
+	// Build a lookup of the class labels for later verification
+	_classes = ARFFClassSet(_header->GetClassLabels());
+
+	// By default every column is read
+	auto columns = vector<int>(); for (auto i = 0; i < _columns; i++) columns.push_back(i);
+	SetSelection(columns);
+
+	// Batches are parsed on the calling thread by default
+	_prefetch = false;
 }
 
 /**
@@ -40,6 +47,7 @@ ARFFReader::ARFFReader(const string& path)
  */
 ARFFReader::~ARFFReader()
 {
+	WaitPending();
 	if (_reader->is_open()) _reader->close(); delete _reader;
 	delete _header;
 }
@@ -73,31 +81,181 @@ Mat ARFFReader::Read()
 {
 	// Verify the reader
 	if (!_reader->is_open()) throw runtime_error("The file is not open");
+	if (_pending.valid()) throw runtime_error("Single reads cannot be mixed with prefetched batches");
+
+	// Read lines until one passes the class filter
+	while (true) 
+	{
+		// If empty then we are at the end I guess
+		if (!getline(*_reader, _line) || _line == string()) return Mat();
+
+		Mat result = Mat_<double>(1, GetOutputColumns());
+		if (ParseLine(_line, (double *) result.data)) return result;
+	}
+}
+
+//--------------------------------------------------
+// Selection
+//--------------------------------------------------
+
+/**
+ * @brief Select the columns that are read (in the order that they are returned)
+ * @param columns The indices of the columns within the file
+ */
+void ARFFReader::SetSelection(const vector<int>& columns)
+{
+	if (_pending.valid()) throw runtime_error("The selection cannot change while a batch is being prefetched");
+	if (columns.empty()) throw runtime_error("At least one column must be selected");
+
+	for (auto column : columns) if (column < 0 || column >= _columns) throw runtime_error("Selected column is out of range");
+
+	_selection = columns; UpdateTargets();
+}
+
+/**
+ * @brief Only return rows with one of the given class labels
+ * @param labels The accepted labels (an empty list removes the filter)
+ */
+void ARFFReader::SetClassFilter(const vector<int>& labels)
+{
+	if (_pending.valid()) throw runtime_error("The class filter cannot change while a batch is being prefetched");
+	if (labels.size() > 0 && _classes.IsEmpty()) throw runtime_error("The file does not have class labels to filter on");
 
-	// Read in the next line
-	auto line = string(); getline(*_reader, line);
+	_classAccepted.clear(); if (labels.empty()) return;
 
-	// If empty then we are at the end I guess
-	if (line == string()) return Mat();
+	_classAccepted.assign(_classes.GetSize(), 0);
+	for (auto label : labels)
+	{
+		auto index = _classes.GetIndex(label);
+		if (index < 0) throw runtime_error("The filter contains a label that is not in the header");
+		_classAccepted[index] = 1;
+	}
+}
 
-	// Get the parts and verify the count
-	auto parts = vector<string>(); StringUtils::Split(line,',', parts);
-	if (parts.size() != _columns) throw runtime_error("The number of numbers dont seem to match the column count");
+/**
+ * @brief Work out where each field of a row is parsed to
+ * @remark The class field is always parsed (into a scratch slot if it is not selected) so that it can be validated
+ */
+void ARFFReader::UpdateTargets()
+{
+	_targets.assign(_columns, -1);
+	for (auto i = 0; i < (int)_selection.size(); i++) _targets[_selection[i]] = i;
+
+	_classSlot = -1;
+	if (!_classes.IsEmpty())
+	{
+		auto classColumn = _columns - 1;
+		if (_targets[classColumn] < 0) _targets[classColumn] = (int)_selection.size();
+		_classSlot = _targets[classColumn];
+	}
+
+	_rowBuffer.assign(_selection.size() + 1, 0);
+}
+
+/**
+ * @brief Parse a line into the output (selected columns only)
+ * @param line The line that we are parsing
+ * @param output The output values
+ * @return true The row passed the class filter
+ * @return false The row was filtered out
+ */
+bool ARFFReader::ParseLine(const string& line, double * output)
+{
+	ARFFParser::ParseFields(line.data(), line.data() + line.size(), _targets, _rowBuffer.data());
 
 	// Verify the classes
-	if (_classes.size() != 0) 
+	if (_classSlot >= 0)
 	{
-		auto classValue = StringUtils::String2Int(parts[parts.size() - 1]);
-		auto valid = _classes.find(classValue) != _classes.end();
-		if (!valid) throw runtime_error("The field lables do not seem to match the header");
+		auto index = _classes.GetIndex(_rowBuffer[_classSlot]);
+		if (index < 0) throw runtime_error("The field lables do not seem to match the header");
+		if (!_classAccepted.empty() && !_classAccepted[index]) return false;
 	}
 
-	// Build the result
-	Mat result = Mat_<double>(1, parts.size()); auto data = (double *) result.data;
-	for (auto i = 0; i < result.cols; i++) data[i] = StringUtils::String2Double(parts[i]); 
+	memcpy(output, _rowBuffer.data(), _selection.size() * sizeof(double));
 
-	// Return the result
-	return result;
+	return true;
+}
+
+//--------------------------------------------------
+// Batch Read
+//--------------------------------------------------
+
+/**
+ * @brief Read up to count records into a reusable matrix
+ * @param count The maximum number of records to read
+ * @param output The output matrix (reallocated only if it is not count x selected columns)
+ * @return int The number of rows filled (zero at the end of the file)
+ * @remark With prefetch enabled the next batch is parsed in the background, and buffers are swapped with the caller's matrix
+ */
+int ARFFReader::ReadBatch(int count, Mat& output)
+{
+	if (count <= 0) throw runtime_error("The batch size must be positive");
+	if (!_prefetch && !_pending.valid()) return FillBatch(count, output);
+
+	// The first call has nothing pending yet
+	if (!_pending.valid()) StartPrefetch(count);
+
+	// Collect the prefetched batch (exceptions from the worker are rethrown here)
+	auto rows = _pending.get();
+	std::swap(output, _prefetchBuffer);
+
+	// Start parsing the next batch while the caller consumes this one
+	if (rows > 0 && _prefetch) StartPrefetch(count);
+
+	return rows;
+}
+
+/**
+ * @brief Turn background parsing of the next batch on or off
+ * @param value Indicates whether batches are prefetched
+ * @remark Turning prefetch off waits for the batch that is being parsed, and that batch is handed back
+ * by the next ReadBatch call (with the batch size it was started with), so no rows are lost
+ */
+void ARFFReader::SetPrefetch(bool value)
+{
+	if (!value) WaitPending();
+	_prefetch = value;
+}
+
+/**
+ * @brief Parse up to count records from the file into the given matrix
+ * @param count The maximum number of records
+ * @param output The output matrix
+ * @return int The number of rows filled
+ */
+int ARFFReader::FillBatch(int count, Mat& output)
+{
+	if (!_reader->is_open()) throw runtime_error("The file is not open");
+
+	auto columns = GetOutputColumns();
+	if (output.rows != count || output.cols != columns || output.type() != CV_64FC1) output.create(count, columns, CV_64FC1);
+
+	auto rows = 0;
+	while (rows < count)
+	{
+		// An empty line marks the end of the data (the same as Read)
+		if (!getline(*_reader, _line) || _line == string()) break;
+		if (ParseLine(_line, output.ptr<double>(rows))) rows++;
+	}
+
+	return rows;
+}
+
+/**
+ * @brief Start parsing the next batch on a background thread
+ * @param count The size of the batch
+ */
+void ARFFReader::StartPrefetch(int count)
+{
+	_pending = async(launch::async, [this, count]() { return FillBatch(count, _prefetchBuffer); });
+}
+
+/**
+ * @brief Wait for any background parsing to finish (ignoring its result)
+ */
+void ARFFReader::WaitPending()
+{
+	if (_pending.valid()) _pending.wait();
 }
 
 //--------------------------------------------------
@@ -109,5 +267,6 @@ Mat ARFFReader::Read()
  */
 void ARFFReader::Close()
 {
+	WaitPending();
 	_reader->close();
 }
@@ -8,7 +8,7 @@
 
 #pragma once
 
-#include <unordered_set>
+#include <future>
 #include <fstream>
 #include <iostream>
 using namespace std;
@@ -18,6 +18,8 @@ using namespace cv;
 
 #include "../StringUtils.h"
 #include "ARFFHeader.h"
+#include "ARFFParser.h"
+#include "ARFFClassSet.h"
 
 namespace NVLib
 {
@@ -27,19 +29,42 @@ namespace NVLib
 		ifstream * _reader;
 		ARFFHeader * _header;
 		int _columns;
-		unordered_set<int> _classes;
+		string _line;
+		vector<int> _selection;
+		vector<int> _targets;
+		vector<double> _rowBuffer;
+		int _classSlot;
+		ARFFClassSet _classes;
+		vector<uchar> _classAccepted;
+		bool _prefetch;
+		Mat _prefetchBuffer;
+		future<int> _pending;
 	public:
 		ARFFReader(const string& path);
 		~ARFFReader();
 
 		Mat ReadAll();
 		Mat Read();
+		int ReadBatch(int count, Mat& output);
 
 		void Close();
 
+		void SetSelection(const vector<int>& columns);
+		void SetClassFilter(const vector<int>& labels);
+		void SetPrefetch(bool value);
+
 		inline ARFFHeader * GetHeader() { return _header; }
+		inline vector<int>& GetSelection() { return _selection; }
+		inline int GetOutputColumns() { return (int)_selection.size(); }
+		inline bool GetPrefetch() { return _prefetch; }
 
 	protected:
 		inline istream& FILE() { return *_reader; }
+	private:
+		void UpdateTargets();
+		bool ParseLine(const string& line, double * output);
+		int FillBatch(int count, Mat& output);
+		void StartPrefetch(int count);
+		void WaitPending();
 	};
 }
@@ -19,10 +19,14 @@ using namespace NVLib;
  */
 ARFFWriter::ARFFWriter(const string& path)
 {
-	_writer = new ofstream(path);
+	_writer = new ofstream(path, ios::binary);
 	if (!_writer->is_open()) throw runtime_error("Unable to open location: " + path);
 
 	_columns = 0; _headerWritten = false;
+	_precision = 12; _asyncFlush = false; _patchRowCount = true;
+	_rowCountOffset = -1; _rows = 0;
+
+	_buffer.resize(BUFFER_SIZE); _flushBuffer.resize(BUFFER_SIZE); _used = 0;
 }
 
 /**
@@ -30,7 +34,9 @@ ARFFWriter::ARFFWriter(const string& path)
  */
 ARFFWriter::~ARFFWriter()
 {
-	if (_writer->is_open()) _writer->close(); delete _writer;
+	// Errors cannot be reported from here, so call Close() explicitly to find out about them
+	try { Close(); } catch (...) {}
+	delete _writer;
 }
 
 //--------------------------------------------------
@@ -58,16 +64,21 @@ void ARFFWriter::WriteHeader(ARFFHeader& header)
 	if (header.GetHasOutput()) _columns++;
 	if (header.GetClassLabels().size() > 0) _columns++;
 
-	// Load in class labels for later verification
-	for (auto label : header.GetClassLabels()) _classes.insert(label);
+	// Build a lookup of the class labels for later verification
+	_classes = ARFFClassSet(header.GetClassLabels());
+
+	// Perform the actual header writing (keeping track of where the row count lives so it can be patched on close)
+	auto start = FILE().tellp();
+	auto offset = header.Save(FILE(), _patchRowCount);
+	if (offset >= 0) _rowCountOffset = start + offset;
 
-	// Perform the actual header writing
-	header.Save(*_writer); _headerWritten = true;
+	_headerWritten = true;
 }
 
 /**
  * @brief Write somne data to the file
- * @param data The data that we are writing to disk
+ * @param data The data that we are writing to disk (CV_64FC1 or CV_32FC1, one record per row)
+ * @remark Values are formatted straight into a large buffer, which only hits the disk when it fills up
  */
 void ARFFWriter::Write(const Mat& data)
 {
@@ -80,31 +91,143 @@ void ARFFWriter::Write(const Mat& data)
 	// Confirm that we have the corect column count
 	if (data.cols != _columns) throw runtime_error("The provided data does not appear to have the correct column count wrt the header");
 
-	// Loop thru the data and process it
-	auto input = (double *) data.data;
+	// Dispatch on the element type
+	if (data.type() == CV_64FC1) WriteRows<double>(data);
+	else if (data.type() == CV_32FC1) WriteRows<float>(data);
+	else throw runtime_error("Only CV_64FC1 and CV_32FC1 data can be written to an ARFF file");
+}
+
+/**
+ * @brief Format the rows of the given matrix into the write buffer
+ * @param data The data that we are writing
+ */
+template <typename T> void ARFFWriter::WriteRows(const Mat& data)
+{
+	auto rowSize = _columns * MAX_FIELD_SIZE + 1;
+
 	for (auto row = 0; row < data.rows; row++) 
 	{
-		auto dataVector = vector<double>();
-		for (auto column = 0; column < data.cols; column++) 
-		{
-			auto index = column + row * data.cols;
-			dataVector.push_back(input[index]);
-		}
+		auto input = data.ptr<T>(row);
 
-		if (_classes.size() > 0 ) 
+		// Validate the class before anything from the row is written
+		if (!_classes.IsEmpty()) ValidateClass(input[_columns - 1]);
+
+		// Make sure that the whole row fits within the buffer
+		if (_buffer.size() - _used < rowSize) FlushBuffer(false);
+		if (_buffer.size() < rowSize) { _buffer.resize(rowSize); _flushBuffer.resize(rowSize); }
+
+		auto position = _buffer.data() + _used;
+		for (auto column = 0; column < _columns; column++) 
 		{
-			auto classValue = (int)dataVector[dataVector.size() - 1];
-			if (_classes.find(classValue) == _classes.end()) throw runtime_error("The provided data does not appear to have valid class labels");
+			if (column != 0) *position++ = ',';
+			position = WriteValue(position, input[column]);
 		}
+		*position++ = '\n';
+
+		_used = position - _buffer.data(); _rows++;
+	}
+}
+
+/**
+ * @brief Format a single value into the buffer
+ * @param position The position that we are writing to
+ * @param value The value that we are writing
+ * @return char * The position after the value
+ */
+char * ARFFWriter::WriteValue(char * position, double value)
+{
+	auto result = to_chars(position, position + MAX_FIELD_SIZE, value, chars_format::fixed, _precision);
+	if (result.ec != errc()) throw runtime_error("Unable to format a value for the ARFF file");
+	return result.ptr;
+}
+
+/**
+ * @brief Confirm that the given value is one of the class labels
+ * @param value The value that we are checking
+ */
+void ARFFWriter::ValidateClass(double value)
+{
+	if (_classes.GetIndex(value) < 0) throw runtime_error("The provided data does not appear to have valid class labels");
+}
+
+//--------------------------------------------------
+// Flush
+//--------------------------------------------------
+
+/**
+ * @brief Push everything that has been written so far to disk
+ */
+void ARFFWriter::Flush()
+{
+	FlushBuffer(true); FILE().flush();
+}
+
+/**
+ * @brief Write the contents of the buffer to the file
+ * @param wait Indicates whether we need the data to have reached the stream before returning
+ * @remark In async mode the full buffer is handed to a background write and filling continues in the spare
+ */
+void ARFFWriter::FlushBuffer(bool wait)
+{
+	// Only one write may be in flight at a time (this also rethrows any write errors)
+	if (_pending.valid()) _pending.get();
 
-		for (auto i = 0; i < dataVector.size(); i++) 
+	if (_used > 0)
+	{
+		std::swap(_buffer, _flushBuffer); auto size = _used; _used = 0;
+
+		auto task = [this, size]()
 		{
-			if (i != 0) FILE() << ",";
-			FILE() << fixed << setprecision(12) << dataVector[i];
-		}
-		FILE() << endl;
+			FILE().write(_flushBuffer.data(), size);
+			if (!FILE()) throw runtime_error("Failed to write to the ARFF file");
+		};
+
+		if (_asyncFlush && !wait) _pending = async(launch::async, task);
+		else task();
 	}
+}
+
+/**
+ * @brief Wait for any background write to finish
+ */
+void ARFFWriter::WaitPending()
+{
+	if (_pending.valid()) _pending.wait();
+}
+
+//--------------------------------------------------
+// Settings
+//--------------------------------------------------
+
+/**
+ * @brief Set the number of decimal places that values are written with
+ * @param value The number of decimal places
+ */
+void ARFFWriter::SetPrecision(int value)
+{
+	if (value < 0 || value > 30) throw runtime_error("The precision must be between 0 and 30");
+	_precision = value;
+}
 
+/**
+ * @brief Indicate whether full buffers are written to disk on a background thread
+ * @param value The new setting
+ */
+void ARFFWriter::SetAsyncFlush(bool value)
+{
+	if (!value) FlushBuffer(true);
+	_asyncFlush = value;
+}
+
+/**
+ * @brief Indicate whether the row count in the header is filled in when the file is closed
+ * @param value The new setting
+ * @remark This has to be decided before the header is written, as it reserves space within the header
+ */
+void ARFFWriter::SetPatchRowCount(bool value)
+{
+	if (_headerWritten) throw runtime_error("The row count setting must be applied before the header is written");
+	_patchRowCount = value;
 }
 
 //--------------------------------------------------
@@ -116,5 +239,25 @@ void ARFFWriter::Write(const Mat& data)
  */
 void ARFFWriter::Close()
 {
+	if (!_writer->is_open()) return;
+
+	// Make sure that a failed background write does not escape the close
+	WaitPending();
+	try { FlushBuffer(true); PatchRowCount(); } catch (...) { _writer->close(); throw; }
+
 	_writer->close();
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Fill in the reserved row count within the header
+ */
+void ARFFWriter::PatchRowCount()
+{
+	if (_rowCountOffset < 0) return;
+
+	auto value = ARFFHeader::FormatRowCount(_rows);
+	FILE().seekp(_rowCountOffset); FILE().write(value.data(), value.size());
+	FILE().seekp(0, ios::end);
+
+	if (!FILE()) throw runtime_error("Failed to update the row count within the ARFF file");
+}
@@ -8,7 +8,8 @@
 
 #pragma once
 
-#include <unordered_set>
+#include <future>
+#include <charconv>
 #include <fstream>
 #include <iostream>
 using namespace std;
@@ -18,16 +19,32 @@ using namespace cv;
 
 #include "../StringUtils.h"
 #include "ARFFHeader.h"
+#include "ARFFClassSet.h"
 
 namespace NVLib
 {
 	class ARFFWriter
 	{
+	private:
+
+		/* Constant */
+		inline static const size_t BUFFER_SIZE = 1 << 20;
+		inline static const size_t MAX_FIELD_SIZE = 400;
+
 	private:
 		ofstream * _writer;
 		int _columns;
-		unordered_set<int> _classes;
+		ARFFClassSet _classes;
 		bool _headerWritten;
+		int _precision;
+		bool _asyncFlush;
+		bool _patchRowCount;
+		streamoff _rowCountOffset;
+		int _rows;
+		vector<char> _buffer;
+		vector<char> _flushBuffer;
+		size_t _used;
+		future<void> _pending;
 	public:
 		ARFFWriter(const string& path);
 		~ARFFWriter();
@@ -35,8 +52,25 @@ namespace NVLib
 		void WriteHeader(ARFFHeader& header);
 		void Write(const Mat& data);
 
+		void Flush();
 		void Close();
+
+		void SetPrecision(int value);
+		void SetAsyncFlush(bool value);
+		void SetPatchRowCount(bool value);
+
+		inline int GetPrecision() { return _precision; }
+		inline bool GetAsyncFlush() { return _asyncFlush; }
+		inline bool GetPatchRowCount() { return _patchRowCount; }
+		inline int GetRowCount() { return _rows; }
 	protected:
 		inline ofstream& FILE() { return *_writer; }
+	private:
+		template <typename T> void WriteRows(const Mat& data);
+		char * WriteValue(char * position, double value);
+		void ValidateClass(double value);
+		void FlushBuffer(bool wait);
+		void WaitPending();
+		void PatchRowCount();
 	};
 }
@@ -0,0 +1,68 @@
+//--------------------------------------------------
+// Implementation of class MappedFile
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "MappedFile.h"
+using namespace NVLib;
+
+#ifdef __unix__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param path The path to the file that we are mapping
+ * @param copyOnWrite Map the pages writable (writes go to private copies and never reach the file)
+ */
+MappedFile::MappedFile(const string& path, bool copyOnWrite) : _path(path), _data(nullptr), _size(0), _mapped(false), _copyOnWrite(copyOnWrite)
+{
+#ifdef __unix__
+	auto handle = open(path.c_str(), O_RDONLY);
+	if (handle < 0) throw runtime_error("Unable to open file: " + path);
+
+	struct stat info; 
+	if (fstat(handle, &info) != 0) { close(handle); throw runtime_error("Unable to determine the size of: " + path); }
+	_size = (size_t) info.st_size;
+
+	if (_size > 0)
+	{
+		auto protection = copyOnWrite ? PROT_READ | PROT_WRITE : PROT_READ;
+		auto memory = mmap(nullptr, _size, protection, MAP_PRIVATE, handle, 0);
+		if (memory != MAP_FAILED)
+		{
+			madvise(memory, _size, MADV_SEQUENTIAL);
+			_data = (const char *) memory; _mapped = true;
+		}
+	}
+
+	close(handle);
+	if (_mapped || _size == 0) { if (_data == nullptr) _data = _buffer.data(); return; }
+#endif
+
+	// Fallback: read the whole file into memory
+	auto reader = ifstream(path, ios::binary);
+	if (!reader.is_open()) throw runtime_error("Unable to open file: " + path);
+	_buffer.assign(istreambuf_iterator<char>(reader), istreambuf_iterator<char>());
+	_data = _buffer.data(); _size = _buffer.size();
+}
+
+/**
+ * @brief Main Terminator
+ */
+MappedFile::~MappedFile()
+{
+#ifdef __unix__
+	if (_mapped) munmap((void *) _data, _size);
+#endif
+}
@@ -0,0 +1,40 @@
+//--------------------------------------------------
+// A memory mapping of a file (falls back to reading the file into memory)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <fstream>
+#include <iostream>
+using namespace std;
+
+namespace NVLib
+{
+	class MappedFile
+	{
+	private:
+		string _path;
+		const char * _data;
+		size_t _size;
+		bool _mapped;
+		bool _copyOnWrite;
+		string _buffer;
+	public:
+		MappedFile(const string& path, bool copyOnWrite = false);
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		inline const char * GetData() { return _data; }
+		inline const char * GetEnd() { return _data + _size; }
+		inline size_t GetSize() { return _size; }
+		inline bool GetMapped() { return _mapped; }
+		inline bool GetCopyOnWrite() { return _copyOnWrite; }
+		inline string& GetPath() { return _path; }
+	};
+}
@@ -98,9 +98,23 @@ Mat CloudUtils::SampleCloud(Mat& colorCloud, int step)
  * @return Return a Mat
  */
 Mat CloudUtils::RenderImage(Mat& colorCloud, Mat & camera, Mat& pose, int step)
+{
+	Mat depth; return RenderImage(colorCloud, camera, pose, depth, step);
+}
+
+/**
+ * Render an image of the cloud, along with the depth of the rendered points
+ * @param colorCloud The cloud that we are sampling
+ * @param camera The camera matrix that we are connecting to
+ * @param pose The pose that we want to sample at
+ * @param depth The output depth map (double, zero where nothing was rendered)
+ * @param step The associated step scaling
+ * @return Return a Mat
+ */
+Mat CloudUtils::RenderImage(Mat& colorCloud, Mat & camera, Mat& pose, Mat& depth, int step)
 {
 	Mat image = Mat::zeros(colorCloud.size(), CV_8UC3);
-	Mat depth = Mat_<double>::zeros(colorCloud.size());
+	depth = Mat_<double>::zeros(colorCloud.size());
 
 	auto input = (double*)colorCloud.data;
 	auto depthData = (double*)depth.data;
@@ -132,15 +146,15 @@ Mat CloudUtils::RenderImage(Mat& colorCloud, Mat & camera, Mat& pose, int step)
 			if (u < 0 || u >= colorCloud.cols || v < 0 || v >= colorCloud.rows) continue;
 			auto index2 = u + v * colorCloud.cols;
 
-			// Determine whether we perform an update
+			// Determine whether we perform an update (the nearest point in the rendered view wins)
 			auto currentZ = depthData[index2];
-			if (currentZ > 0 && currentZ < Z) continue;
+			if (tscene.z <= 0 || (currentZ > 0 && currentZ < tscene.z)) continue;
 
 			// Perform updates
 			image.data[index2 * 3 + 0] = R;
 			image.data[index2 * 3 + 1] = G;
 			image.data[index2 * 3 + 2] = B;
-			depthData[index2] = Z;
+			depthData[index2] = tscene.z;
 		}
 	}
 
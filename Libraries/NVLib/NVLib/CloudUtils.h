@@ -23,6 +23,7 @@ namespace NVLib
 		static Mat BuildColorCloud(Mat & camera, Mat& color, Mat& depth);
 		static Mat SampleCloud(Mat& colorCloud, int step = 1);
 		static Mat RenderImage(Mat& colorCloud, Mat& camera, Mat& pose, int step = 1);
+		static Mat RenderImage(Mat& colorCloud, Mat& camera, Mat& pose, Mat& depth, int step = 1);
 		static Mat TransformCloud(Mat& colorCloud, Mat& pose);
 		static Mat ProjectImagePoints(Mat& camera, Mat& cloud);
 		static int GetVertexCount(Mat& colorCloud);
@@ -128,24 +128,28 @@ Mat DrawUtils::GetRectangleMask(const Size& imageSize, const Rect& rect)
  */
 Mat DrawUtils::OverlayMask(Mat& image, Mat& overlay, const Scalar& color) 
 {
+	if (image.type() != CV_8UC3) throw runtime_error("Input needs to be an 8-bit color image");
+	if (overlay.type() != CV_8UC1 || overlay.size() != image.size()) throw runtime_error("The overlay needs to be an 8-bit image the same size as the input");
+
 	Mat result = image.clone();
+	// The channels are truncated (not rounded) to match the original assignment of the scalar into the image
+	auto c1 = (uchar)std::min(std::max(color[0], 0.0), 255.0);
+	auto c2 = (uchar)std::min(std::max(color[1], 0.0), 255.0);
+	auto c3 = (uchar)std::min(std::max(color[2], 0.0), 255.0);
 
-	for (auto row = 0; row < result.rows; row++) 
+	parallel_for_(Range(0, result.rows), [&](const Range& range)
 	{
-		for (auto column = 0; column < result.cols; column++) 
+		for (auto row = range.start; row < range.end; row++) 
 		{
-			auto index = column + row * result.cols;
-
-			auto flag = overlay.data[index] != 0;
+			auto flags = overlay.ptr<uchar>(row); auto output = result.ptr<uchar>(row);
 
-			if (flag) 
+			for (auto column = 0; column < result.cols; column++, output += 3) 
 			{
-				result.data[index * 3 + 0] = color[0];
-				result.data[index * 3 + 1] = color[1];
-				result.data[index * 3 + 2] = color[2];
-			}	
+				if (flags[column] == 0) continue;
+				output[0] = c1; output[1] = c2; output[2] = c3;
+			}
 		}
-	}
+	});
 
 	return result;
 }
@@ -163,23 +167,24 @@ Mat DrawUtils::OverlayMask(Mat& image, Mat& overlay, const Scalar& color)
 Mat DrawUtils::ExtractMask(Mat& image, Mat& mask) 
 {
 	if (mask.rows != image.rows || mask.cols != image.cols) throw runtime_error("The image and the mask need to be the same size");
+	if (image.type() != CV_8UC3 || mask.type() != CV_8UC1) throw runtime_error("Expected an 8-bit color image and an 8-bit mask");
 
-	auto result = image.clone();
+	Mat result = image.clone();
 
-	for (auto row = 0; row < image.rows; row++) 
+	parallel_for_(Range(0, image.rows), [&](const Range& range)
 	{
-		for (auto column = 0; column < image.cols; column++) 
+		for (auto row = range.start; row < range.end; row++) 
 		{
-			auto index = column + row * image.cols;
-			auto maskValue = mask.data[index];
-			
-			if (maskValue != 0) continue;
-
-			result.data[index * 3 + 0] = 0;
-			result.data[index * 3 + 1] = 0;
-			result.data[index * 3 + 2] = 0;	
+			auto maskRow = mask.ptr<uchar>(row); auto output = result.ptr<uchar>(row);
+
+			for (auto column = 0; column < image.cols; column++, output += 3) 
+			{
+				// Multiplying by a 0/1 keep flag lets the compiler vectorise the loop
+				auto keep = (uchar)(maskRow[column] != 0);
+				output[0] *= keep; output[1] *= keep; output[2] *= keep;
+			}
 		}
-	}
+	});
 
 	return result;
 }
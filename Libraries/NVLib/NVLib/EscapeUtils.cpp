@@ -31,3 +31,63 @@ string EscapeUtils::MySqlEscape(const string& value)
 
 	return result.str();
 }
+
+//--------------------------------------------------
+// JSON
+//--------------------------------------------------
+
+/**
+ * @brief Escape a string so that it can be placed within JSON quotes
+ * @param value The value that we are escaping
+ * @return string The escaped value
+ */
+string EscapeUtils::JsonEscape(const string& value)
+{
+	auto result = string();
+
+	for (auto character : value)
+	{
+		if (character == '"' || character == '\\') { result += '\\'; result += character; }
+		else if (character == '\n') result += "\\n";
+		else if (character == '\r') result += "\\r";
+		else if (character == '\t') result += "\\t";
+		else if ((unsigned char)character < 0x20)
+		{
+			// The remaining control characters are not allowed in a JSON string
+			char code[7]; snprintf(code, sizeof(code), "\\u%04x", (unsigned char)character);
+			result += code;
+		}
+		else result += character;
+	}
+
+	return result;
+}
+
+/**
+ * @brief Format a number for JSON export (non-finite values are written as null)
+ * @param value The value that we are formatting
+ * @return string The formatted value (10 significant digits)
+ */
+string EscapeUtils::JsonNumber(double value)
+{
+	if (!isfinite(value)) return "null";
+	auto writer = stringstream(); writer << setprecision(10) << value;
+	return writer.str();
+}
+
+//--------------------------------------------------
+// CSV
+//--------------------------------------------------
+
+/**
+ * @brief Format a number for CSV export (non-finite values are written as nan, inf or -inf)
+ * @param value The value that we are formatting
+ * @return string The formatted value (10 significant digits)
+ */
+string EscapeUtils::CsvNumber(double value)
+{
+	if (isnan(value)) return "nan";
+	if (isinf(value)) return value > 0 ? "inf" : "-inf";
+	auto writer = stringstream(); writer << setprecision(10) << value;
+	return writer.str();
+}
@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
 #include <sstream>
 #include <iostream>
 using namespace std;
@@ -18,5 +21,8 @@ namespace NVLib
 	{
 	public:
 		static string MySqlEscape(const string& value);
+		static string JsonEscape(const string& value);
+		static string JsonNumber(double value);
+		static string CsvNumber(double value);
 	};
 }
@@ -13,21 +13,220 @@ using namespace NVLib;
 
 /**
  * Calculates a histogram for the given image
- * @param grayImage The gray image that we are getting the histogram for
+ * @param grayImage The gray image that we are getting the histogram for (CV_8UC1)
  * @return Return a Mat
  */
 Mat ImageUtils::GetHistogram(Mat& grayImage)
 {
+	if (grayImage.type() != CV_8UC1) throw runtime_error("Input needs to be an 8-bit grayscale image");
+
 	Mat histogram = Mat_<int>::zeros(256, 1);
-	auto pixelCount = grayImage.rows * grayImage.cols;
-	auto histogramData = (int*)histogram.data;
-	
-	for (auto i = 0; i < pixelCount; i++)
+	AccumulateGray(grayImage, Range(0, grayImage.rows), (int *)histogram.data);
+	return histogram;
+}
+
+/**
+ * Calculates a histogram of the pixels that fall within a mask
+ * @param grayImage The gray image that we are getting the histogram for (CV_8UC1)
+ * @param mask The mask (any non-zero value is counted)
+ * @return Return a Mat
+ */
+Mat ImageUtils::GetHistogram(Mat& grayImage, Mat& mask)
+{
+	if (grayImage.type() != CV_8UC1) throw runtime_error("Input needs to be an 8-bit grayscale image");
+	if (mask.type() != CV_8UC1 || mask.size() != grayImage.size()) throw runtime_error("The mask needs to be an 8-bit image the same size as the input");
+
+	Mat histogram = Mat_<int>::zeros(256, 1);
+	AccumulateMasked(grayImage, mask, Range(0, grayImage.rows), (int *)histogram.data, nullptr);
+	return histogram;
+}
+
+/**
+ * Calculates a histogram for the given image, splitting the rows across threads
+ * @param grayImage The gray image that we are getting the histogram for (CV_8UC1)
+ * @return Return a Mat
+ */
+Mat ImageUtils::GetHistogramParallel(Mat& grayImage)
+{
+	if (grayImage.type() != CV_8UC1) throw runtime_error("Input needs to be an 8-bit grayscale image");
+
+	// Each strip of rows is accumulated into its own row of partial histograms
+	auto strips = GetStripCount(grayImage.rows);
+	Mat partials = Mat_<int>::zeros(strips, 256);
+
+	parallel_for_(Range(0, strips), [&](const Range& range)
+	{
+		for (auto strip = range.start; strip < range.end; strip++)
+		{
+			auto rows = Range(strip * grayImage.rows / strips, (strip + 1) * grayImage.rows / strips);
+			AccumulateGray(grayImage, rows, partials.ptr<int>(strip));
+		}
+	});
+
+	return ReduceStrips(partials, 256);
+}
+
+/**
+ * Calculates a masked histogram, splitting the rows across threads
+ * @param grayImage The gray image that we are getting the histogram for (CV_8UC1)
+ * @param mask The mask (any non-zero value is counted)
+ * @return Return a Mat
+ */
+Mat ImageUtils::GetHistogramParallel(Mat& grayImage, Mat& mask)
+{
+	if (grayImage.type() != CV_8UC1) throw runtime_error("Input needs to be an 8-bit grayscale image");
+	if (mask.type() != CV_8UC1 || mask.size() != grayImage.size()) throw runtime_error("The mask needs to be an 8-bit image the same size as the input");
+
+	auto strips = GetStripCount(grayImage.rows);
+	Mat partials = Mat_<int>::zeros(strips, 256);
+
+	parallel_for_(Range(0, strips), [&](const Range& range)
+	{
+		for (auto strip = range.start; strip < range.end; strip++)
+		{
+			auto rows = Range(strip * grayImage.rows / strips, (strip + 1) * grayImage.rows / strips);
+			AccumulateMasked(grayImage, mask, rows, partials.ptr<int>(strip), nullptr);
+		}
+	});
+
+	return ReduceStrips(partials, 256);
+}
+
+/**
+ * Calculates a histogram of a 16-bit depth map
+ * @param depth The depth map (CV_16UC1)
+ * @param shift The number of low bits to drop from each value (the histogram has 65536 >> shift bins)
+ * @return Return a Mat
+ * @remark Zero (missing) depth values are counted in bin 0 like any other value
+ */
+Mat ImageUtils::GetDepthHistogram(Mat& depth, int shift)
+{
+	if (depth.type() != CV_16UC1) throw runtime_error("Input needs to be a 16-bit depth map");
+	if (shift < 0 || shift > 15) throw runtime_error("The depth histogram shift must be between 0 and 15");
+
+	auto binCount = 65536 >> shift;
+	auto strips = GetStripCount(depth.size(), binCount);
+	Mat partials = Mat_<int>::zeros(strips, binCount);
+
+	parallel_for_(Range(0, strips), [&](const Range& range)
+	{
+		for (auto strip = range.start; strip < range.end; strip++)
+		{
+			auto output = partials.ptr<int>(strip);
+			auto start = strip * depth.rows / strips; auto end = (strip + 1) * depth.rows / strips;
+
+			for (auto row = start; row < end; row++)
+			{
+				auto input = depth.ptr<ushort>(row);
+				for (auto column = 0; column < depth.cols; column++) output[input[column] >> shift]++;
+			}
+		}
+	});
+
+	return ReduceStrips(partials, binCount);
+}
+
+/**
+ * Accumulate the histogram of a range of rows
+ * @param grayImage The image that we are processing
+ * @param rows The rows that we are processing
+ * @param output The histogram that we are adding to
+ * @remark Four sub-histograms are used so that runs of the same value don't stall on the same counter
+ */
+void ImageUtils::AccumulateGray(Mat& grayImage, const Range& rows, int * output)
+{
+	int bins[4][256] = {};
+
+	for (auto row = rows.start; row < rows.end; row++)
 	{
-		histogramData[grayImage.data[i]]++;
+		auto input = grayImage.ptr<uchar>(row); auto column = 0;
+
+		for (; column + 4 <= grayImage.cols; column += 4)
+		{
+			bins[0][input[column]]++; bins[1][input[column + 1]]++;
+			bins[2][input[column + 2]]++; bins[3][input[column + 3]]++;
+		}
+
+		for (; column < grayImage.cols; column++) bins[0][input[column]]++;
 	}
 
-	return histogram;
+	for (auto i = 0; i < 256; i++) output[i] += bins[0][i] + bins[1][i] + bins[2][i] + bins[3][i];
+}
+
+/**
+ * Accumulate the histograms inside and outside a mask for a range of rows
+ * @param grayImage The image that we are processing
+ * @param mask The mask (any non-zero value is inside)
+ * @param rows The rows that we are processing
+ * @param innerOutput The inside histogram that we are adding to
+ * @param outerOutput The outside histogram that we are adding to (can be nullptr)
+ * @remark The mask selects the histogram by index rather than by branch, so the loop has no unpredictable jumps
+ */
+void ImageUtils::AccumulateMasked(Mat& grayImage, Mat& mask, const Range& rows, int * innerOutput, int * outerOutput)
+{
+	int bins[2][2][256] = {};
+
+	for (auto row = rows.start; row < rows.end; row++)
+	{
+		auto input = grayImage.ptr<uchar>(row); auto maskRow = mask.ptr<uchar>(row); auto column = 0;
+
+		for (; column + 2 <= grayImage.cols; column += 2)
+		{
+			bins[0][maskRow[column] != 0][input[column]]++;
+			bins[1][maskRow[column + 1] != 0][input[column + 1]]++;
+		}
+
+		for (; column < grayImage.cols; column++) bins[0][maskRow[column] != 0][input[column]]++;
+	}
+
+	for (auto i = 0; i < 256; i++)
+	{
+		innerOutput[i] += bins[0][1][i] + bins[1][1][i];
+		if (outerOutput != nullptr) outerOutput[i] += bins[0][0][i] + bins[1][0][i];
+	}
+}
+
+/**
+ * Sum the partial histograms of each strip
+ * @param partials The partial histograms (one per row)
+ * @param binCount The number of bins
+ * @return Mat The combined histogram (binCount x 1)
+ */
+Mat ImageUtils::ReduceStrips(Mat& partials, int binCount)
+{
+	Mat result = Mat_<int>::zeros(binCount, 1); auto output = (int *)result.data;
+
+	for (auto strip = 0; strip < partials.rows; strip++)
+	{
+		auto input = partials.ptr<int>(strip);
+		for (auto i = 0; i < binCount; i++) output[i] += input[i];
+	}
+
+	return result;
+}
+
+/**
+ * Determine how many strips to split an image into for parallel processing
+ * @param rows The number of rows in the image
+ * @return int The strip count (enough to keep all the cores busy, but never more than the row count)
+ */
+int ImageUtils::GetStripCount(int rows)
+{
+	return std::max(1, std::min(rows, cv::getNumThreads() * 4));
+}
+
+/**
+ * Determine how many strips to use for a histogram with a large number of bins
+ * @param size The size of the image
+ * @param binCount The number of bins within the histogram
+ * @return int The strip count (at most one per worker, and few enough that clearing and reducing the partials costs no more than the pixels)
+ */
+int ImageUtils::GetStripCount(const Size& size, int binCount)
+{
+	if (binCount <= 256) return GetStripCount(size.height);
+
+	auto pixelLimit = (int)std::min<int64_t>((int64_t)size.width * size.height / binCount, INT32_MAX);
+	return std::max(1, std::min({ size.height, cv::getNumThreads(), pixelLimit }));
 }
 
 //--------------------------------------------------
@@ -192,21 +391,23 @@ void ImageUtils::GetContours(Mat& binaryImage, vector<vector<Point>>& contours)
  */
 Mat ImageUtils::GetColorBinary(Mat& image, const Vec3i& color) 
 {
-	Mat mask = Mat_<uchar>::zeros(image.size());
+	if (image.type() != CV_8UC3) throw runtime_error("Input needs to be an 8-bit color image");
+
+	Mat mask = Mat_<uchar>(image.size());
 
-	for (auto row = 0; row < image.rows; row++) 
+	parallel_for_(Range(0, image.rows), [&](const Range& range)
 	{
-		for (auto column = 0; column < image.cols; column++) 
+		for (auto row = range.start; row < range.end; row++) 
 		{
-			auto index = column + row * image.cols;
-			auto c1 = image.data[index * 3 + 0];
-			auto c2 = image.data[index * 3 + 1];
-			auto c3 = image.data[index * 3 + 2];
-		
-			if (c1 != color[0] || c2 != color[1] || c3 != color[2]) mask.data[index] = 255;			
-			else mask.data[index] = 0;
-		}	
-	}
+			auto input = image.ptr<uchar>(row); auto output = mask.ptr<uchar>(row);
+
+			for (auto column = 0; column < image.cols; column++, input += 3) 
+			{
+				auto different = (input[0] != color[0]) | (input[1] != color[1]) | (input[2] != color[2]);
+				output[column] = different ? 255 : 0;
+			}
+		}
+	});
 
 	return mask;
 }
@@ -223,24 +424,31 @@ Mat ImageUtils::GetColorBinary(Mat& image, const Vec3i& color)
  */
 Mat ImageUtils::GetMaskImage(Mat& image, Mat& mask, const Vec3i& color) 
 {
+	if (image.type() != CV_8UC3) throw runtime_error("Input needs to be an 8-bit color image");
+	if (mask.type() != CV_8UC1 || mask.size() != image.size()) throw runtime_error("The mask needs to be an 8-bit image the same size as the input");
+
+	// The blend only depends on the channel value, so it is precalculated for every value
+	uchar blend[3][256];
+	for (auto channel = 0; channel < 3; channel++) 
+	{
+		for (auto value = 0; value < 256; value++) blend[channel][value] = saturate_cast<uchar>((value + color[channel]) / 2.0);
+	}
+
 	Mat result = image.clone();
 
-	for (auto row = 0; row < image.rows; row++) 
+	parallel_for_(Range(0, image.rows), [&](const Range& range)
 	{
-		for (auto column = 0; column < image.cols; column++) 
+		for (auto row = range.start; row < range.end; row++) 
 		{
-			auto index = column + row * image.cols;
-			if (mask.data[index] == 0) continue;
-			
-			auto c1 = (double)image.data[index * 3 + 0];
-			auto c2 = (double)image.data[index * 3 + 1];
-			auto c3 = (double)image.data[index * 3 + 2];
-
-			result.data[index * 3 + 0] = saturate_cast<uchar>((c1 + color[0]) / 2.0);
-			result.data[index * 3 + 1] = saturate_cast<uchar>((c2 + color[1]) / 2.0);
-			result.data[index * 3 + 2] = saturate_cast<uchar>((c3 + color[2]) / 2.0);
-		}	
-	}
+			auto maskRow = mask.ptr<uchar>(row); auto output = result.ptr<uchar>(row);
+
+			for (auto column = 0; column < image.cols; column++, output += 3) 
+			{
+				if (maskRow[column] == 0) continue;
+				output[0] = blend[0][output[0]]; output[1] = blend[1][output[1]]; output[2] = blend[2][output[2]];
+			}
+		}
+	});
 
 	return result;
 }
@@ -301,35 +509,36 @@ Mat ImageUtils::GetGradientMap(Mat& image)
  * @param magnitude The list of "color" magnitudes
  * @param direction The list of "color" directions
  * @return Mat The reusltant matrix
+ * @remark The best magnitude and direction are kept as floats (earlier versions truncated them to integers)
  */
 Mat ImageUtils::GetColorGradient(Mat& magnitude, Mat& direction) 
 {
-	assert(magnitude.rows == direction.rows && magnitude.cols == direction.cols);
-
-	auto mdata = (float *) magnitude.data; auto ddata = (float *) direction.data;
+	if (magnitude.type() != CV_32FC3 || direction.type() != CV_32FC3) throw runtime_error("The gradient images need to be 3 channel float images");
+	if (magnitude.size() != direction.size()) throw runtime_error("The magnitude and direction images need to be the same size");
 
 	Mat result = Mat_<Vec2f>(magnitude.size());
-	auto output = (float *) result.data;
 
-	for (auto row = 0; row < result.rows; row++) 
+	parallel_for_(Range(0, result.rows), [&](const Range& range)
 	{
-		for (auto column = 0; column < result.cols; column++) 
+		for (auto row = range.start; row < range.end; row++) 
 		{
-			auto bestMagnitude = 0; auto bestDirection = 0;	
-			auto baseIndex = column + row * result.cols;
+			auto mdata = magnitude.ptr<float>(row); auto ddata = direction.ptr<float>(row);
+			auto output = result.ptr<float>(row);
 
-			for (auto channel = 0; channel < 3; channel++) 
+			for (auto column = 0; column < result.cols; column++, mdata += 3, ddata += 3, output += 2) 
 			{
-				auto index = baseIndex * 3 + channel;
-				auto currentM = mdata[index];
-				auto currentD = ddata[index];
-				if (currentM > bestMagnitude) { bestMagnitude = currentM; bestDirection = currentD; }
-			}
+				// Keep the channel with the strongest gradient (a zero gradient has no direction)
+				auto bestMagnitude = 0.0f; auto bestDirection = 0.0f;
+
+				for (auto channel = 0; channel < 3; channel++) 
+				{
+					if (mdata[channel] > bestMagnitude) { bestMagnitude = mdata[channel]; bestDirection = ddata[channel]; }
+				}
 
-			output[baseIndex * 2 + 0] = bestMagnitude;
-			output[baseIndex * 2 + 1] = bestDirection;		
+				output[0] = bestMagnitude; output[1] = bestDirection;
+			}
 		}
-	}
+	});
 
 	return result;
 }
@@ -363,17 +572,18 @@ Mat ImageUtils::GetNormalizedGrayImage(Mat& image)
 Mat ImageUtils::InvertMask(Mat& maskImage) 
 {
 	if (maskImage.channels() != 1) throw runtime_error("A mask image can only have 1 channel");
+	if (maskImage.depth() != CV_8U) throw runtime_error("A mask image needs to be an 8-bit image");
 
 	Mat result = Mat_<uchar>(maskImage.size());
 
-	for (auto row = 0; row < maskImage.rows; row++) 
+	parallel_for_(Range(0, maskImage.rows), [&](const Range& range)
 	{
-		for (auto column = 0; column < maskImage.cols; column++) 
+		for (auto row = range.start; row < range.end; row++) 
 		{
-			auto index = column + row * maskImage.cols;
-			result.data[index] = maskImage.data[index] == 0 ? 255 : 0;
+			auto input = maskImage.ptr<uchar>(row); auto output = result.ptr<uchar>(row);
+			for (auto column = 0; column < maskImage.cols; column++) output[column] = input[column] == 0 ? 255 : 0;
 		}
-	}
+	});
 
 	return result;
 }
@@ -393,24 +603,14 @@ void ImageUtils::GetInOutHistograms(Mat& grayImage, Mat& mask, Mat& innerHist, M
 {
 	// Verify that we have a gray image
 	if (grayImage.channels() != 1) throw runtime_error("Input needs to be a grayscale image");
+	if (grayImage.type() != CV_8UC1) throw runtime_error("Input needs to be an 8-bit grayscale image");
+	if (mask.type() != CV_8UC1 || mask.size() != grayImage.size()) throw runtime_error("The mask needs to be an 8-bit image the same size as the input");
 
 	// Initialize the histograms with zeros
 	innerHist = Mat_<int>::zeros(256, 1); outerHist = Mat_<int>::zeros(256, 1);
-	auto innerData = (int *)innerHist.data; auto outerData = (int *)outerHist.data;;
-
-	// loop through the data and update the histograms
-	for (auto row = 0; row < grayImage.rows; row++) 
-	{
-		for (auto column = 0; column < grayImage.cols; column++) 
-		{
-			auto index = column + row * grayImage.cols;
-			auto maskValue = mask.data[index];
-			auto color = grayImage.data[index];
 
-			if (maskValue == 0) outerData[color]++;
-			else innerData[color]++; // Note the assumption says ANY value that is not zero is foreground!!!
-		}
-	}
+	// Note the assumption says ANY value that is not zero is foreground!!!
+	AccumulateMasked(grayImage, mask, Range(0, grayImage.rows), (int *)innerHist.data, (int *)outerHist.data);
 }
 
 //--------------------------------------------------
@@ -445,30 +645,59 @@ int ImageUtils::GetPixelCount(Mat& histogram)
  */
 int ImageUtils::GetPixelCount(Mat& image, const Scalar& color) 
 {
+	if (image.depth() != CV_8U || image.channels() > 4) throw runtime_error("Pixel counts are only supported for 8-bit images with up to 4 channels");
+
 	// Setup values
-	auto accumulator = 0; auto channels = image.channels();
+	auto channels = image.channels(); auto accumulator = atomic<int>(0);
+
+	// Pixels with a channel that can't match (outside 0-255 or fractional) are never counted
+	int expected[4]; for (auto channel = 0; channel < 4; channel++) expected[channel] = color[channel] == (int)color[channel] ? (int)color[channel] : -1;
 
-	// Loop through the values and update the accumulator
-	for (auto row = 0; row < image.rows; row++) 
+	// Loop through the values and update the accumulator (once per block of rows)
+	parallel_for_(Range(0, image.rows), [&](const Range& range)
 	{
-		for (auto column = 0; column < image.cols; column++) 
+		auto count = 0;
+
+		for (auto row = range.start; row < range.end; row++) 
 		{
-			auto index = column + row * image.cols;
+			auto input = image.ptr<uchar>(row);
 
-			bool match = true;
-			for (auto channel = 0; channel < channels; channel++) 
+			for (auto column = 0; column < image.cols; column++, input += channels) 
 			{
-				auto imageColor = image.data[index * channels + channel];		
-				auto expectedColor = color[channel];
-				match &= expectedColor == imageColor;
+				auto match = true;
+				for (auto channel = 0; channel < channels; channel++) match &= input[channel] == expected[channel];
+				count += match ? 1 : 0;
 			}
-
-			if (match) accumulator++;	
 		}
-	}
+
+		accumulator += count;
+	});
 
 	// Return the result
-	return accumulator;
+	return accumulator.load();
+}
+
+/**
+ * @brief Count the number of set pixels of a mask within a region
+ * @param maskStats The region statistics of the mask
+ * @param region The region that we are counting in (clipped to the mask)
+ * @return int The number of non-zero pixels
+ * @remark This is a constant time lookup, so it suits repeated queries against the same mask
+ */
+int ImageUtils::GetPixelCount(RegionStats& maskStats, const Rect& region) 
+{
+	return maskStats.GetCount(region);
+}
+
+/**
+ * @brief Find the mean depth of the valid pixels within a region
+ * @param depthStats The region statistics of the depth map
+ * @param region The region that we are averaging (clipped to the depth map)
+ * @return double The mean depth (zero if there is no valid depth within the region)
+ */
+double ImageUtils::GetMeanDepth(RegionStats& depthStats, const Rect& region) 
+{
+	return depthStats.GetValidMean(region);
 }
 
 //--------------------------------------------------
@@ -509,43 +738,138 @@ int ImageUtils::Hist2PD(Mat& histogram, Mat& distribution)
 //--------------------------------------------------
 
 /**
- * @brief Perform canny edge detection without parameters
+ * @brief Apply the canny operator with thresholds derived from the median intensity
  * @param image The image that we are processing
- * @param sigma The sigma that we are using
- * @return Mat the resultant edge map
+ * @param sigma The spread of the thresholds around the median
+ * @return Mat The resultant edge image
  */
 Mat ImageUtils::AutoCanny(Mat& image, float sigma) 
 {
-   	// Convert to grey colour space
-    Mat gray; cvtColor( image, gray, COLOR_BGR2GRAY );
-    
+	CannyWorkspace workspace; Mat result;
+	AutoCanny(image, result, workspace, sigma);
+	return result;
+}
+
+/**
+ * @brief Apply the canny operator with thresholds derived from the median intensity (reusing buffers)
+ * @param image The image that we are processing (color or 8-bit grayscale)
+ * @param output The resultant edge image
+ * @param workspace The buffers that are reused between calls
+ * @param sigma The spread of the thresholds around the median
+ * @param sampleStep Only every n-th row and column is used for the median (1 gives the exact median)
+ */
+void ImageUtils::AutoCanny(Mat& image, Mat& output, CannyWorkspace& workspace, float sigma, int sampleStep) 
+{
+	// Convert to grey colour space
+	Mat gray = image;
+	if (image.channels() != 1) { cvtColor(image, workspace.gray, COLOR_BGR2GRAY); gray = workspace.gray; }
+
 	// Apply small amount of Gaussian blurring
-	GaussianBlur(gray, gray, cv::Size( 3, 3), 0, 0);
-    
+	GaussianBlur(gray, workspace.blurred, cv::Size( 3, 3), 0, 0);
+
 	// Get the median value of the matrix
-    double median = GetMedian(gray);
-    
+	double median = GetMedian(workspace.blurred, sampleStep, workspace.histogram);
+
 	// Generate the thresholds
-    int lower = (int)std::max(0.0, (1.0f - sigma) * median);
-    int upper = (int)std::min(255.0, (1.0f + sigma) * median);
-    
+	int lower = (int)std::max(0.0, (1.0f - sigma) * median);
+	int upper = (int)std::min(255.0, (1.0f + sigma) * median);
+
 	// Apply canny operator
-	Mat result; cv::Canny(gray, result, lower, upper);
-    
-	// Return the result
-	return result;
+	cv::Canny(workspace.blurred, output, lower, upper);
 }
 
+//--------------------------------------------------
+// Median
+//--------------------------------------------------
+
 /**
  * @brief Given a "grayscale" matrix - find the median value
  * @param matrix The matrix that we are calculating
+ * @param sampleStep Only every n-th row and column is used (1 gives the exact median)
+ * @return double The resultant median value
+ * @remark 8-bit and 16-bit single channel inputs are found in linear time through a histogram
+ */
+double ImageUtils::GetMedian(Mat& matrix, int sampleStep) 
+{
+	vector<int> histogram; return GetMedian(matrix, sampleStep, histogram);
+}
+
+/**
+ * @brief Find the median bin of a histogram
+ * @param histogram The histogram (a single row or column of 32-bit counts)
+ * @return int The index of the median bin (upper median when the count is even)
+ */
+int ImageUtils::GetHistogramMedian(Mat& histogram) 
+{
+	if (histogram.type() != CV_32SC1 || !histogram.isContinuous()) throw runtime_error("Expected a continuous 32-bit histogram");
+	return GetHistogramMedian((int *)histogram.data, (int)histogram.total());
+}
+
+/**
+ * @brief Given a "grayscale" matrix - find the median value (reusing the histogram buffer)
+ * @param matrix The matrix that we are calculating
+ * @param sampleStep Only every n-th row and column is used
+ * @param histogram The buffer that the histogram is built in
  * @return double The resultant median value
  */
-double ImageUtils::GetMedian(Mat& matrix) 
+double ImageUtils::GetMedian(Mat& matrix, int sampleStep, vector<int>& histogram) 
 {
- 	Mat input = matrix.reshape(0,1);// spread Input Mat to single row
-    std::vector<double> vecFromMat;
-    input.copyTo(vecFromMat); // Copy Input Mat to vector vecFromMat
-    std::nth_element(vecFromMat.begin(), vecFromMat.begin() + vecFromMat.size() / 2, vecFromMat.end());
-    return vecFromMat[vecFromMat.size() / 2];
+	if (matrix.empty()) throw runtime_error("Cannot find the median of an empty matrix");
+	if (sampleStep < 1) throw runtime_error("The median sample step must be at least 1");
+
+	auto type = matrix.type();
+
+	if (type == CV_8UC1 || type == CV_16UC1)
+	{
+		auto binCount = type == CV_8UC1 ? 256 : 65536;
+		histogram.assign(binCount, 0); auto output = histogram.data();
+
+		for (auto row = 0; row < matrix.rows; row += sampleStep)
+		{
+			if (type == CV_8UC1) 
+			{
+				auto input = matrix.ptr<uchar>(row);
+				for (auto column = 0; column < matrix.cols; column += sampleStep) output[input[column]]++;
+			}
+			else 
+			{
+				auto input = matrix.ptr<ushort>(row);
+				for (auto column = 0; column < matrix.cols; column += sampleStep) output[input[column]]++;
+			}
+		}
+
+		return GetHistogramMedian(output, binCount);
+	}
+
+	// Other types fall back to a selection over a copy of the (sampled) values
+	Mat sample = matrix;
+	if (sampleStep > 1) resize(matrix, sample, Size((matrix.cols + sampleStep - 1) / sampleStep, (matrix.rows + sampleStep - 1) / sampleStep), 0, 0, INTER_NEAREST);
+
+	Mat input = sample.isContinuous() ? sample.reshape(0, 1) : sample.clone().reshape(0, 1);
+	std::vector<double> vecFromMat;
+	input.copyTo(vecFromMat);
+	std::nth_element(vecFromMat.begin(), vecFromMat.begin() + vecFromMat.size() / 2, vecFromMat.end());
+	return vecFromMat[vecFromMat.size() / 2];
+}
+
+/**
+ * @brief Find the median bin of a histogram
+ * @param histogram The histogram counts
+ * @param binCount The number of bins within the histogram
+ * @return int The index of the median bin (matches selecting element n / 2 of the sorted values)
+ */
+int ImageUtils::GetHistogramMedian(const int * histogram, int binCount) 
+{
+	auto total = int64_t(0);
+	for (auto i = 0; i < binCount; i++) total += histogram[i];
+
+	auto target = total / 2; auto cumulative = int64_t(0);
+
+	for (auto i = 0; i < binCount; i++) 
+	{
+		cumulative += histogram[i];
+		if (cumulative > target) return i;
+	}
+
+	return binCount - 1;
 }
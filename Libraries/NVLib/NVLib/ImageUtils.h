@@ -7,19 +7,34 @@
 #pragma once
 
 #include <iostream>
+#include <atomic>
 using namespace std;
 
 #include <opencv2/opencv.hpp>
 using namespace cv;
 
+#include "RegionStats.h"
+
 typedef pair<int, int> Pair;
 
 namespace NVLib
 {
+	/* Buffers that AutoCanny reuses between calls (keep one per thread to avoid per-frame allocations) */
+	struct CannyWorkspace
+	{
+		Mat gray;
+		Mat blurred;
+		vector<int> histogram;
+	};
+
 	class ImageUtils
 	{
 	public:
 		static Mat GetHistogram(Mat& grayImage);
+		static Mat GetHistogram(Mat& grayImage, Mat& mask);
+		static Mat GetHistogramParallel(Mat& grayImage);
+		static Mat GetHistogramParallel(Mat& grayImage, Mat& mask);
+		static Mat GetDepthHistogram(Mat& depth, int shift = 0);
 		static Mat GetCumulativeHistogram(Mat& histogram);
 		static int GetUpperPercentileIntensity(Mat& chistogram, double percentile);
 		static void GetOrderedLabelCounts(Mat& labelMap, int labelCount, vector<Pair>& result);
@@ -37,9 +52,20 @@ namespace NVLib
 		static void GetInOutHistograms(Mat& grayImage, Mat& mask, Mat& innerHist, Mat& outerHist);
 		static int GetPixelCount(Mat& histogram);
 		static int GetPixelCount(Mat& image, const Scalar& color);
+		static int GetPixelCount(RegionStats& maskStats, const Rect& region);
+		static double GetMeanDepth(RegionStats& depthStats, const Rect& region);
 		static int Hist2PD(Mat& histogram, Mat& distribution);
 		static Mat AutoCanny(Mat& image, float sigma = 0.33);
+		static void AutoCanny(Mat& image, Mat& output, CannyWorkspace& workspace, float sigma = 0.33, int sampleStep = 1);
+		static double GetMedian(Mat& matrix, int sampleStep = 1);
+		static int GetHistogramMedian(Mat& histogram);
 	private:
-		static double GetMedian(Mat& matrix);	
+		static double GetMedian(Mat& matrix, int sampleStep, vector<int>& histogram);
+		static int GetHistogramMedian(const int * histogram, int binCount);
+		static void AccumulateGray(Mat& grayImage, const Range& rows, int * output);
+		static void AccumulateMasked(Mat& grayImage, Mat& mask, const Range& rows, int * innerOutput, int * outerOutput);
+		static Mat ReduceStrips(Mat& partials, int binCount);
+		static int GetStripCount(int rows);
+		static int GetStripCount(const Size& size, int binCount);
 	};
 }
\ No newline at end of file
@@ -18,6 +18,7 @@ using namespace NVLib;
  */
 Mat LoadUtils::LoadImage(const std::string& path)
 {
+	static auto& latency = Metrics::GetHistogram("nvlib_image_read_ns"); MetricTimer timer(latency);
 	cv::Mat image = imread(path, IMREAD_COLOR);
 	if (image.empty()) throw runtime_error("Unable to load image: " + path);
  	return image;
@@ -34,6 +35,7 @@ Mat LoadUtils::LoadImage(const std::string& path)
  */
 Mat LoadUtils::LoadMask(const string& path) 
 {
+	static auto& latency = Metrics::GetHistogram("nvlib_image_read_ns"); MetricTimer timer(latency);
 	cv::Mat image = cv::imread(path, cv::IMREAD_GRAYSCALE);
 	if (image.empty()) throw runtime_error("Unable to load image: " + path);
 	return image;
@@ -50,6 +52,7 @@ Mat LoadUtils::LoadMask(const string& path)
  */
 Mat LoadUtils::LoadGray(const std::string& path) 
 {
+	static auto& latency = Metrics::GetHistogram("nvlib_image_read_ns"); MetricTimer timer(latency);
 	cv::Mat image = cv::imread(path, cv::IMREAD_GRAYSCALE);
 	if (image.empty()) throw runtime_error("Unable to load image: " + path);
 	return image;
@@ -129,6 +132,7 @@ MonoCalibration * LoadUtils::LoadCalibration(const string& path)
  */
 DepthFrame * LoadUtils::LoadDepthFrame(const string& colorPath, const string& depthPath) 
 {
+	static auto& latency = Metrics::GetHistogram("nvlib_depth_frame_read_ns"); MetricTimer timer(latency);
 	Mat color = imread(colorPath); Mat depth = imread(depthPath, IMREAD_UNCHANGED);
 	return new DepthFrame(color, depth);
 }
@@ -12,6 +12,8 @@ using namespace std;
 #include <opencv2/opencv.hpp>
 using namespace cv;
 
+#include "Metrics.h"
+
 #include "Model/StereoFrame.h"
 #include "Model/StereoCalibration.h"
 #include "Model/MonoCalibration.h"
@@ -0,0 +1,103 @@
+//--------------------------------------------------
+// A bounded lock-free queue of log records (many producers, one consumer)
+//
+// @author: Wild Boar
+//--------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+#include <iostream>
+using namespace std;
+
+namespace NVLib
+{
+	/* A single pre-formatted log line */
+	struct LogRecord
+	{
+		/* Constant */
+		inline static const int TEXT_SIZE = 1024;
+
+		atomic<size_t> sequence;
+		int targets;
+		int length;
+		char text[TEXT_SIZE];
+	};
+
+	class LogQueue
+	{
+	private:
+		vector<LogRecord> _records;
+		size_t _mask;
+		alignas(64) atomic<size_t> _tail;
+		alignas(64) size_t _head;
+	public:
+
+		/**
+		 * @brief Main Constructor
+		 * @param capacity The number of records within the queue (rounded up to a power of two)
+		 */
+		LogQueue(int capacity) : _tail(0), _head(0)
+		{
+			auto size = size_t(1); while (size < (size_t)std::max(capacity, 2)) size <<= 1;
+
+			_records = vector<LogRecord>(size); _mask = size - 1;
+			for (auto i = size_t(0); i < size; i++) _records[i].sequence.store(i, memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Add a record to the queue (safe to call from any thread)
+		 * @param targets The outputs that the record is going to
+		 * @param text The text of the record
+		 * @param length The length of the text (truncated to the record size)
+		 * @return true The record was added
+		 * @return false The queue was full
+		 */
+		bool Push(int targets, const char * text, int length)
+		{
+			auto position = _tail.load(memory_order_relaxed);
+
+			while (true)
+			{
+				auto& record = _records[position & _mask];
+				auto sequence = record.sequence.load(memory_order_acquire);
+				auto difference = (intptr_t)sequence - (intptr_t)position;
+
+				if (difference == 0)
+				{
+					if (_tail.compare_exchange_weak(position, position + 1, memory_order_relaxed)) 
+					{
+						record.targets = targets; record.length = std::min(length, LogRecord::TEXT_SIZE);
+						memcpy(record.text, text, record.length);
+						record.sequence.store(position + 1, memory_order_release);
+						return true;
+					}
+				}
+				else if (difference < 0) return false;
+				else position = _tail.load(memory_order_relaxed);
+			}
+		}
+
+		/**
+		 * @brief Retrieve the oldest record (only the consumer thread may call this)
+		 * @return LogRecord * The record, or nullptr if the queue is empty (call Release once it has been written)
+		 */
+		LogRecord * Peek()
+		{
+			auto& record = _records[_head & _mask];
+			if (record.sequence.load(memory_order_acquire) != _head + 1) return nullptr;
+			return &record;
+		}
+
+		/**
+		 * @brief Hand the slot of the record returned by Peek back to the producers
+		 */
+		void Release()
+		{
+			_records[_head & _mask].sequence.store(_head + _mask + 1, memory_order_release);
+			_head++;
+		}
+	};
+}
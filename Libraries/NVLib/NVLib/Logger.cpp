@@ -18,9 +18,9 @@ using namespace NVLib;
  * @param consoleLevel The level of messages to log to the console
  * @param fileLevel The level of messages to log to file
  */
-Logger::Logger(int consoleLevel, int fileLevel)
+Logger::Logger(int consoleLevel, int fileLevel) : _overflow(LogOverflow::DROP), _running(false), _dropped(0)
 {
-	_file = nullptr; _startTime = 0; _functionStartTime = 0; _currentFunction = "";
+	_file = nullptr; _startTime = 0;
 	_consoleLevel = consoleLevel;
 	_fileLevel = fileLevel;
 
@@ -36,6 +36,7 @@ Logger::Logger(int consoleLevel, int fileLevel)
  */
 Logger::~Logger()
 {
+	StopAsync();
 	if (_file != nullptr) fclose(_file);
 }
 
@@ -47,45 +48,164 @@ Logger::~Logger()
  * Log a message to the system
  * @param level The level associated with the message
  * @param message The message that we are logging
+ * @remark This is safe to call from any thread
  */
 void Logger::Log(int level, const char * message, ...)
 {
-	va_list argumentPointer; va_start(argumentPointer, message);
-	auto fullMessage = GetTimeStamp() + message + "\n";
-
-#ifdef __unix__
-	if (level <= _consoleLevel) vfprintf(stdout, fullMessage.c_str(), argumentPointer);
-	if (level <= _fileLevel) vfprintf(_file, fullMessage.c_str(), argumentPointer);
-#else
-	if (level <= _consoleLevel) vfprintf_s(stdout, fullMessage.c_str(), argumentPointer);
-	if (level <= _fileLevel) vfprintf_s(_file, fullMessage.c_str(), argumentPointer);
-#endif
+	auto targets = GetTargets(level); if (targets == 0) return;
 
+	char buffer[LogRecord::TEXT_SIZE];
+	va_list argumentPointer; va_start(argumentPointer, message);
+	auto length = Format(buffer, sizeof(buffer), message, argumentPointer);
 	va_end(argumentPointer);
+
+	Submit(targets, buffer, length);
 }
 
 /**
- * Log an error to the system  
+ * Log an error to the system (and throw it as a string)
+ * @param level The level associated with the message
+ * @param message The message that we are logging
  */
 void Logger::LogError(int level, const char* message, ...) 
 {
-	char exceptionString[500];
+	char buffer[LogRecord::TEXT_SIZE];
 	va_list argumentPointer; va_start(argumentPointer, message);
-	auto fullMessage = GetTimeStamp() + message + "\n";
-
-#ifdef __unix__
-	if (level <= _consoleLevel) vfprintf(stdout, fullMessage.c_str(), argumentPointer);
-	if (level <= _fileLevel) vfprintf(_file, fullMessage.c_str(), argumentPointer);
-#else
-	if (level <= _consoleLevel) vfprintf_s(stdout, fullMessage.c_str(), argumentPointer);
-	if (level <= _fileLevel) vfprintf_s(_file, fullMessage.c_str(), argumentPointer);
-#endif
-	
-	snprintf(exceptionString, 500, fullMessage.c_str(), argumentPointer);
+	auto length = Format(buffer, sizeof(buffer), message, argumentPointer);
 	va_end(argumentPointer);
-	throw string(fullMessage);
+
+	Submit(GetTargets(level), buffer, length);
+	throw string(buffer, length);
 }
 
+/**
+ * Format a message (with its time stamp) into a buffer
+ * @param buffer The buffer that we are writing to
+ * @param size The size of the buffer
+ * @param message The printf style message
+ * @param arguments The arguments for the message
+ * @return The length of the formatted text (messages that do not fit are truncated)
+ */
+int Logger::Format(char * buffer, int size, const char * message, va_list arguments)
+{
+	auto length = GetTimeStamp(buffer);
+
+	auto written = vsnprintf(buffer + length, size - length - 1, message, arguments);
+	length = std::min(length + std::max(written, 0), size - 2);
+
+	buffer[length++] = '\n'; buffer[length] = 0;
+	return length;
+}
+
+/**
+ * Determine the outputs that a message of the given level goes to
+ * @param level The level of the message
+ * @return The set of targets
+ */
+int Logger::GetTargets(int level)
+{
+	auto result = 0;
+	if (level <= _consoleLevel) result |= TARGET_CONSOLE;
+	if (level <= _fileLevel && _file != nullptr) result |= TARGET_FILE;
+	return result;
+}
+
+/**
+ * Send a formatted record to its outputs (via the queue if we are in async mode)
+ * @param targets The outputs that the record is going to
+ * @param text The text of the record
+ * @param length The length of the text
+ */
+void Logger::Submit(int targets, const char * text, int length)
+{
+	if (targets == 0) return;
+
+	if (_queue == nullptr) { Write(targets, text, length); return; }
+
+	while (!_queue->Push(targets, text, length))
+	{
+		if (_overflow == LogOverflow::DROP) { _dropped++; return; }
+		this_thread::yield();
+	}
+}
+
+/**
+ * Write text to the outputs
+ * @param targets The outputs that we are writing to
+ * @param text The text that we are writing
+ * @param length The length of the text
+ */
+void Logger::Write(int targets, const char * text, int length)
+{
+	lock_guard<mutex> lock(_writeLock);
+
+	if (targets & TARGET_CONSOLE) { fwrite(text, 1, length, stdout); fflush(stdout); }
+	if (targets & TARGET_FILE) { fwrite(text, 1, length, _file); fflush(_file); }
+}
+
+//--------------------------------------------------
+// Async Mode
+//--------------------------------------------------
+
+/**
+ * Switch to async mode, where log calls only queue their record and a background thread does the writing
+ * @param capacity The number of records that can be waiting to be written
+ * @param overflow What to do when the queue is full (drop the record and count it, or wait for space)
+ * @remark This should be called before any worker threads start logging
+ */
+void Logger::StartAsync(int capacity, LogOverflow overflow)
+{
+	if (_queue != nullptr) throw runtime_error("The logger is already in async mode");
+
+	_queue = make_unique<LogQueue>(capacity); _overflow = overflow; _dropped = 0;
+	_running = true; _worker = thread(&Logger::WriterLoop, this);
+}
+
+/**
+ * Write out everything that is still queued and switch back to synchronous logging
+ */
+void Logger::StopAsync()
+{
+	if (_queue == nullptr) return;
+
+	_running = false; _worker.join(); _queue.reset();
+
+	if (_dropped > 0 && _consoleLevel >= 0)
+	{
+		auto text = GetTimeStamp() + "Logger dropped " + to_string(_dropped.load()) + " records\n";
+		Write(TARGET_CONSOLE, text.data(), (int)text.size());
+	}
+}
+
+/**
+ * The background thread that drains the queue, batching the writes for each output
+ */
+void Logger::WriterLoop()
+{
+	auto console = string(); auto file = string();
+
+	while (true)
+	{
+		auto running = _running.load();
+
+		LogRecord * record = nullptr; auto count = 0;
+		while ((record = _queue->Peek()) != nullptr)
+		{
+			if (record->targets & TARGET_CONSOLE) console.append(record->text, record->length);
+			if (record->targets & TARGET_FILE) file.append(record->text, record->length);
+			_queue->Release(); count++;
+		}
+
+		if (count > 0)
+		{
+			if (!console.empty()) Write(TARGET_CONSOLE, console.data(), (int)console.size());
+			if (!file.empty()) Write(TARGET_FILE, file.data(), (int)file.size());
+			console.clear(); file.clear();
+		}
+		else if (!running) break;
+		else this_thread::sleep_for(chrono::milliseconds(1));
+	}
+}
 
 //--------------------------------------------------
 // Stop Watch
@@ -98,7 +218,8 @@ void Logger::StartApplication()
 {
 	if (_consoleLevel < 0) return;
 	_startTime = getTickCount();
-	cout << GetTimeStamp() << "Starting Application" << endl;
+	auto text = GetTimeStamp() + "Starting Application\n";
+	Submit(TARGET_CONSOLE, text.data(), (int)text.size());
 }
 
 /**
@@ -109,19 +230,22 @@ void Logger::StopApplication()
 	if (_consoleLevel < 0) return;
 	auto endTime = getTickCount();
 	auto elapsed = (endTime - _startTime) / getTickFrequency();
-	cout << GetTimeStamp() << "Stopping Application - Time Elapsed: " << elapsed << " seconds" << endl;
+	auto text = GetTimeStamp() + "Stopping Application - Time Elapsed: " + to_string(elapsed) + " seconds\n";
+	Submit(TARGET_CONSOLE, text.data(), (int)text.size());
 }
 
 /**
  * Indicates that a function is starting
  * @param functionName The function that we are starting
+ * @remark Functions may be nested, each StopFunction closes the most recent one (use ProfileScope for timings across threads)
  */
 void Logger::StartFunction(const string& functionName)
 {
 	if (_consoleLevel < 0) return;
-	_currentFunction = functionName;
-	_functionStartTime = getTickCount();
-	cout << GetTimeStamp() << "Starting function: " << functionName << endl;
+	_functionNames.push_back(functionName);
+	_functionStartTimes.push_back(getTickCount());
+	auto text = GetTimeStamp() + "Starting function: " + functionName + "\n";
+	Submit(TARGET_CONSOLE, text.data(), (int)text.size());
 }
 
 /**
@@ -129,10 +253,12 @@ void Logger::StartFunction(const string& functionName)
  */
 void Logger::StopFunction()
 {
-	if (_consoleLevel < 0) return;
+	if (_consoleLevel < 0 || _functionNames.empty()) return;
 	auto endTime = getTickCount();
-	auto elapsed = (endTime - _functionStartTime) / getTickFrequency();
-	cout << GetTimeStamp() << "Stopping " << _currentFunction << " - Time Elapsed: " << elapsed << " seconds" << endl;
+	auto elapsed = (endTime - _functionStartTimes.back()) / getTickFrequency();
+	auto text = GetTimeStamp() + "Stopping " + _functionNames.back() + " - Time Elapsed: " + to_string(elapsed) + " seconds\n";
+	_functionNames.pop_back(); _functionStartTimes.pop_back();
+	Submit(TARGET_CONSOLE, text.data(), (int)text.size());
 }
 
 //--------------------------------------------------
@@ -145,20 +271,37 @@ void Logger::StopFunction()
  */
 string Logger::GetTimeStamp() 
 {
-	time_t rawtime;
-	char buffer[80];
+	char buffer[32]; auto length = GetTimeStamp(buffer);
+	return string(buffer, length);
+}
+
+/**
+ * Write the time stamp into a buffer
+ * @param buffer The buffer that we are writing to (at least 32 characters)
+ * @return The length of the time stamp
+ * @remark The formatted text is cached per thread, so localtime is only called once a second
+ */
+int Logger::GetTimeStamp(char * buffer) 
+{
+	thread_local time_t cachedTime = -1; 
+	thread_local char cachedText[32]; 
+	thread_local int cachedLength = 0;
+
+	auto rawtime = time(nullptr);
 
-	time(&rawtime); 
-	
+	if (rawtime != cachedTime)
+	{
 #ifdef __unix__
-	struct tm * timeinfo;
-	timeinfo = localtime(&rawtime);
-	strftime(buffer, sizeof(buffer), "[%d-%m-%Y %H:%M:%S] ", timeinfo);
+		struct tm timeinfo;
+		localtime_r(&rawtime, &timeinfo);
 #else
-	struct tm timeinfo;
-	localtime_s(&timeinfo, &rawtime);
-	strftime(buffer, sizeof(buffer), "[%d-%m-%Y %H:%M:%S] ", &timeinfo);
+		struct tm timeinfo;
+		localtime_s(&timeinfo, &rawtime);
 #endif
+		cachedLength = (int)strftime(cachedText, sizeof(cachedText), "[%d-%m-%Y %H:%M:%S] ", &timeinfo);
+		cachedTime = rawtime;
+	}
 
-	return string(buffer);
+	memcpy(buffer, cachedText, cachedLength);
+	return cachedLength;
 }
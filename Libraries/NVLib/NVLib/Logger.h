@@ -9,6 +9,10 @@
 #pragma once
 
 #include <cstdarg>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <memory>
 #include <fstream>
 #include <iostream>
 using namespace std;
@@ -16,17 +20,42 @@ using namespace std;
 #include <opencv2/opencv.hpp>
 using namespace cv;
 
+#include "LogQueue.h"
+
+/* Log calls above this level are removed at compile time (define it lower to strip verbose diagnostics) */
+#ifndef NVLIB_LOG_LEVEL
+#define NVLIB_LOG_LEVEL 100
+#endif
+
+/* Log through these so that filtered messages never evaluate or format their arguments */
+#define NVLIB_LOG(logger, level, ...) do { if constexpr ((level) <= NVLIB_LOG_LEVEL) { if ((logger).IsEnabled(level)) (logger).Log((level), __VA_ARGS__); } } while (0)
+
 namespace NVLib
 {
+	/* Defines what happens when the async queue is full */
+	enum class LogOverflow { DROP, BLOCK };
+
 	class Logger
 	{
+	private:
+
+		/* Constant: the outputs that a record is sent to */
+		inline static const int TARGET_CONSOLE = 1;
+		inline static const int TARGET_FILE = 2;
+
 	private:
 		int64 _startTime;
-		int64 _functionStartTime;
-		string _currentFunction;
+		vector<int64> _functionStartTimes;
+		vector<string> _functionNames;
 		FILE * _file;
 		int _consoleLevel;
 		int _fileLevel;
+		mutex _writeLock;
+		unique_ptr<LogQueue> _queue;
+		LogOverflow _overflow;
+		atomic<bool> _running;
+		atomic<uint64> _dropped;
+		thread _worker;
 	public:
 		Logger(int  consoleLevel, int fileLevel = 0);
 		~Logger();
@@ -37,7 +66,20 @@ namespace NVLib
 		void StopApplication();
 		void StartFunction(const string & functionName);
 		void StopFunction();
+
+		void StartAsync(int capacity = 4096, LogOverflow overflow = LogOverflow::DROP);
+		void StopAsync();
+
+		inline bool IsEnabled(int level) { return level <= _consoleLevel || (level <= _fileLevel && _file != nullptr); }
+		inline bool IsAsync() { return _queue != nullptr; }
+		inline uint64 GetDropped() { return _dropped.load(); }
 	private:
+		int Format(char * buffer, int size, const char * message, va_list arguments);
+		int GetTargets(int level);
+		void Submit(int targets, const char * text, int length);
+		void Write(int targets, const char * text, int length);
+		void WriterLoop();
 		string GetTimeStamp();
+		int GetTimeStamp(char * buffer);
 	};
 }
@@ -0,0 +1,281 @@
+//--------------------------------------------------
+// Implementation of the metrics registry
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "Metrics.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Static State
+//--------------------------------------------------
+
+atomic<int> MetricCounter::_nextShard(0);
+
+mutex Metrics::_lock;
+map<string, unique_ptr<MetricCounter>> Metrics::_counters;
+map<string, unique_ptr<MetricGauge>> Metrics::_gauges;
+map<string, unique_ptr<MetricHistogram>> Metrics::_histograms;
+
+mutex Metrics::_snapshotLock;
+condition_variable Metrics::_snapshotSignal;
+thread Metrics::_snapshotThread;
+bool Metrics::_snapshotRunning = false;
+
+/* Stops a snapshot thread that is still running at exit (e.g. after an exception), which would otherwise terminate the program */
+static struct SnapshotGuard { ~SnapshotGuard() { Metrics::StopSnapshots(); } } _snapshotGuard;
+
+//--------------------------------------------------
+// Histogram Buckets
+//--------------------------------------------------
+
+/**
+ * @brief Find the bucket that a value falls into
+ * @param value The value that we are placing
+ * @return int The index of the bucket
+ * @remark Values below 8 get their own bucket, above that each power of two is split into 8 linear buckets
+ */
+int MetricHistogram::GetBucket(uint64_t value)
+{
+	if (value < SUB_BUCKETS) return (int)value;
+
+#if defined(__GNUC__) || defined(__clang__)
+	auto exponent = 63 - __builtin_clzll(value);
+#else
+	auto exponent = 0; while ((value >> (exponent + 1)) != 0) exponent++;
+#endif
+
+	auto sub = (int)((value >> (exponent - 3)) & (SUB_BUCKETS - 1));
+	return SUB_BUCKETS + (exponent - 3) * SUB_BUCKETS + sub;
+}
+
+/**
+ * @brief Retrieve the smallest value that falls within a bucket
+ * @param index The index of the bucket
+ * @return uint64_t The lower bound (inclusive)
+ */
+uint64_t MetricHistogram::GetBucketLower(int index)
+{
+	if (index < SUB_BUCKETS) return (uint64_t)index;
+
+	auto shift = (index - SUB_BUCKETS) / SUB_BUCKETS; auto sub = (index - SUB_BUCKETS) % SUB_BUCKETS;
+	return uint64_t(SUB_BUCKETS + sub) << shift;
+}
+
+/**
+ * @brief Retrieve the end of a bucket
+ * @param index The index of the bucket
+ * @return uint64_t The upper bound (exclusive)
+ */
+uint64_t MetricHistogram::GetBucketUpper(int index)
+{
+	if (index == BUCKET_COUNT - 1) return UINT64_MAX;
+	return GetBucketLower(index + 1);
+}
+
+/**
+ * @brief Retrieve the number of values that have been recorded
+ * @return uint64_t The sum of the bucket counts (kept out of Record so that an update only touches one counter)
+ */
+uint64_t MetricHistogram::GetCount()
+{
+	auto result = uint64_t(0);
+	for (auto& bucket : _buckets) result += bucket.load(memory_order_relaxed);
+	return result;
+}
+
+/**
+ * @brief Estimate a percentile from the buckets
+ * @param fraction The percentile as a fraction (0.5 = median)
+ * @return double The middle of the bucket containing the percentile (0 if nothing has been recorded)
+ */
+double MetricHistogram::GetPercentile(double fraction)
+{
+	auto total = GetCount(); if (total == 0) return 0;
+
+	auto target = (uint64_t)ceil(fraction * total); if (target == 0) target = 1;
+
+	auto seen = uint64_t(0);
+	for (auto i = 0; i < BUCKET_COUNT; i++) 
+	{
+		seen += _buckets[i].load(memory_order_relaxed);
+		if (seen >= target) return i < SUB_BUCKETS ? (double)i : 0.5 * ((double)GetBucketLower(i) + (double)GetBucketUpper(i) - 1);
+	}
+
+	return (double)GetMax();
+}
+
+//--------------------------------------------------
+// Registry
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve (or create) the counter with the given name
+ * @param name The name of the counter
+ * @return MetricCounter& The counter (the reference stays valid, so callers should keep it rather than look it up per update)
+ */
+MetricCounter& Metrics::GetCounter(const string& name)
+{
+	lock_guard<mutex> lock(_lock);
+	auto& entry = _counters[name]; if (entry == nullptr) entry = make_unique<MetricCounter>();
+	return *entry;
+}
+
+/**
+ * @brief Retrieve (or create) the gauge with the given name
+ * @param name The name of the gauge
+ * @return MetricGauge& The gauge
+ */
+MetricGauge& Metrics::GetGauge(const string& name)
+{
+	lock_guard<mutex> lock(_lock);
+	auto& entry = _gauges[name]; if (entry == nullptr) entry = make_unique<MetricGauge>();
+	return *entry;
+}
+
+/**
+ * @brief Retrieve (or create) the histogram with the given name
+ * @param name The name of the histogram
+ * @return MetricHistogram& The histogram
+ */
+MetricHistogram& Metrics::GetHistogram(const string& name)
+{
+	lock_guard<mutex> lock(_lock);
+	auto& entry = _histograms[name]; if (entry == nullptr) entry = make_unique<MetricHistogram>();
+	return *entry;
+}
+
+//--------------------------------------------------
+// Snapshots
+//--------------------------------------------------
+
+/**
+ * @brief Save a snapshot of all the metrics
+ * @param path The path that we are saving to (written to a temporary file first, so readers never see a partial file)
+ * @param format The format of the output
+ */
+void Metrics::Save(const string& path, MetricsFormat format)
+{
+	auto tempPath = path + ".tmp";
+
+	auto writer = ofstream(tempPath);
+	if (!writer.is_open()) throw runtime_error("Unable to open location: " + tempPath);
+
+	if (format == MetricsFormat::JSON) WriteJson(writer); else WritePrometheus(writer);
+	writer.close();
+
+	if (rename(tempPath.c_str(), path.c_str()) != 0) throw runtime_error("Unable to write location: " + path);
+}
+
+/**
+ * @brief Start saving snapshots on a background thread
+ * @param path The path that we are saving to
+ * @param interval The number of seconds between snapshots
+ * @param format The format of the output
+ */
+void Metrics::StartSnapshots(const string& path, double interval, MetricsFormat format)
+{
+	lock_guard<mutex> lock(_snapshotLock);
+	if (_snapshotRunning) throw runtime_error("Metric snapshots have already been started");
+
+	_snapshotRunning = true;
+	_snapshotThread = thread([path, interval, format]() 
+	{
+		auto delay = chrono::duration<double>(interval);
+		unique_lock<mutex> lock(_snapshotLock);
+
+		while (_snapshotRunning) 
+		{
+			if (_snapshotSignal.wait_for(lock, delay, []() { return !_snapshotRunning; })) break;
+			try { Save(path, format); } catch (runtime_error& exception) { cerr << "Metrics: " << exception.what() << endl; }
+		}
+	});
+}
+
+/**
+ * @brief Stop the background snapshots
+ * @remark Callers should call Save afterwards to capture the final values
+ */
+void Metrics::StopSnapshots()
+{
+	{
+		lock_guard<mutex> lock(_snapshotLock);
+		if (!_snapshotRunning) return;
+		_snapshotRunning = false;
+	}
+
+	_snapshotSignal.notify_all(); _snapshotThread.join();
+}
+
+//--------------------------------------------------
+// Writers
+//--------------------------------------------------
+
+/**
+ * @brief Write the metrics as JSON
+ * @param writer The stream that we are writing to
+ */
+void Metrics::WriteJson(ostream& writer)
+{
+	lock_guard<mutex> lock(_lock);
+
+	writer << "{" << endl << "  \"counters\": {"; auto first = true;
+	for (auto& entry : _counters) { writer << (first ? "" : ",") << endl << "    \"" << EscapeUtils::JsonEscape(entry.first) << "\": " << entry.second->Get(); first = false; }
+
+	writer << endl << "  }," << endl << "  \"gauges\": {"; first = true;
+	for (auto& entry : _gauges) { writer << (first ? "" : ",") << endl << "    \"" << EscapeUtils::JsonEscape(entry.first) << "\": " << entry.second->Get(); first = false; }
+
+	writer << endl << "  }," << endl << "  \"histograms\": {"; first = true;
+	for (auto& entry : _histograms) 
+	{
+		auto& histogram = *entry.second;
+		writer << (first ? "" : ",") << endl << "    \"" << EscapeUtils::JsonEscape(entry.first) << "\": { ";
+		writer << "\"count\": " << histogram.GetCount() << ", \"sum\": " << histogram.GetSum() << ", \"max\": " << histogram.GetMax();
+		writer << ", \"p50\": " << histogram.GetPercentile(0.5) << ", \"p90\": " << histogram.GetPercentile(0.9) << ", \"p99\": " << histogram.GetPercentile(0.99) << " }";
+		first = false;
+	}
+
+	writer << endl << "  }" << endl << "}" << endl;
+}
+
+/**
+ * @brief Write the metrics in the Prometheus text exposition format
+ * @param writer The stream that we are writing to
+ * @remark Only the non-empty histogram buckets are written, to keep the output small
+ */
+void Metrics::WritePrometheus(ostream& writer)
+{
+	lock_guard<mutex> lock(_lock);
+
+	for (auto& entry : _counters) 
+	{
+		writer << "# TYPE " << entry.first << " counter" << endl;
+		writer << entry.first << " " << entry.second->Get() << endl;
+	}
+
+	for (auto& entry : _gauges) 
+	{
+		writer << "# TYPE " << entry.first << " gauge" << endl;
+		writer << entry.first << " " << entry.second->Get() << endl;
+	}
+
+	for (auto& entry : _histograms) 
+	{
+		auto& histogram = *entry.second; auto cumulative = uint64_t(0);
+		writer << "# TYPE " << entry.first << " histogram" << endl;
+
+		for (auto i = 0; i < MetricHistogram::BUCKET_COUNT - 1; i++) 
+		{
+			auto count = histogram.GetBucketCount(i); if (count == 0) continue;
+			cumulative += count;
+			writer << entry.first << "_bucket{le=\"" << MetricHistogram::GetBucketUpper(i) - 1 << "\"} " << cumulative << endl;
+		}
+
+		writer << entry.first << "_bucket{le=\"+Inf\"} " << histogram.GetCount() << endl;
+		writer << entry.first << "_sum " << histogram.GetSum() << endl;
+		writer << entry.first << "_count " << histogram.GetCount() << endl;
+	}
+}
@@ -0,0 +1,161 @@
+//--------------------------------------------------
+// A registry of counters, gauges and latency histograms that can be snapshotted to disk
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <vector>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+using namespace std;
+
+#include "EscapeUtils.h"
+
+namespace NVLib
+{
+	/* Defines the output formats for snapshots */
+	enum class MetricsFormat { JSON, PROMETHEUS };
+
+	/* A counter that is sharded across threads so that updates do not contend */
+	class MetricCounter
+	{
+	private:
+
+		/* Constant */
+		inline static const int SHARD_COUNT = 16;
+
+		/* Each shard lives on its own cache line */
+		struct alignas(64) Shard { atomic<int64_t> value{0}; };
+
+	private:
+		Shard _shards[SHARD_COUNT];
+		static atomic<int> _nextShard;
+	public:
+
+		/**
+		 * @brief Add to the counter (a single relaxed add on the calling thread's shard)
+		 * @param value The amount that we are adding
+		 */
+		inline void Add(int64_t value = 1) { _shards[GetShardIndex()].value.fetch_add(value, memory_order_relaxed); }
+
+		/**
+		 * @brief Retrieve the current total
+		 * @return int64_t The sum of the shards
+		 */
+		int64_t Get()
+		{
+			auto result = int64_t(0);
+			for (auto& shard : _shards) result += shard.value.load(memory_order_relaxed);
+			return result;
+		}
+	private:
+		inline static int GetShardIndex() 
+		{
+			// Constant initialised, so the access does not go through a thread_local init guard
+			thread_local int index = -1;
+			if (index < 0) index = _nextShard.fetch_add(1, memory_order_relaxed) % SHARD_COUNT;
+			return index;
+		}
+	};
+
+	/* A value that is overwritten (the last write wins) */
+	class MetricGauge
+	{
+	private:
+		atomic<double> _value{0};
+	public:
+		inline void Set(double value) { _value.store(value, memory_order_relaxed); }
+		inline double Get() { return _value.load(memory_order_relaxed); }
+	};
+
+	/* A log-linear histogram (8 linear buckets per power of two, so values are within 12.5%) */
+	class MetricHistogram
+	{
+	public:
+
+		/* Constant */
+		inline static const int SUB_BUCKETS = 8;
+		inline static const int BUCKET_COUNT = SUB_BUCKETS + (64 - 3) * SUB_BUCKETS;
+
+	private:
+		atomic<uint64_t> _buckets[BUCKET_COUNT];
+		atomic<uint64_t> _sum{0};
+		atomic<uint64_t> _max{0};
+	public:
+		MetricHistogram() { for (auto& bucket : _buckets) bucket.store(0, memory_order_relaxed); }
+
+		/**
+		 * @brief Record a value within the histogram
+		 * @param value The value that we are recording (negative values are recorded as zero)
+		 */
+		inline void Record(int64_t value)
+		{
+			auto positive = value < 0 ? uint64_t(0) : (uint64_t)value;
+			_buckets[GetBucket(positive)].fetch_add(1, memory_order_relaxed);
+			_sum.fetch_add(positive, memory_order_relaxed);
+
+			auto current = _max.load(memory_order_relaxed);
+			while (positive > current && !_max.compare_exchange_weak(current, positive, memory_order_relaxed));
+		}
+
+		uint64_t GetCount();
+		inline uint64_t GetSum() { return _sum.load(memory_order_relaxed); }
+		inline uint64_t GetMax() { return _max.load(memory_order_relaxed); }
+		inline uint64_t GetBucketCount(int index) { return _buckets[index].load(memory_order_relaxed); }
+
+		double GetPercentile(double fraction);
+
+		static int GetBucket(uint64_t value);
+		static uint64_t GetBucketLower(int index);
+		static uint64_t GetBucketUpper(int index);
+	};
+
+	/* Records the time between construction and destruction into a histogram (in nanoseconds) */
+	class MetricTimer
+	{
+	private:
+		MetricHistogram& _histogram;
+		chrono::steady_clock::time_point _start;
+	public:
+		MetricTimer(MetricHistogram& histogram) : _histogram(histogram), _start(chrono::steady_clock::now()) {}
+		~MetricTimer() { _histogram.Record(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - _start).count()); }
+	};
+
+	class Metrics
+	{
+	private:
+		static mutex _lock;
+		static map<string, unique_ptr<MetricCounter>> _counters;
+		static map<string, unique_ptr<MetricGauge>> _gauges;
+		static map<string, unique_ptr<MetricHistogram>> _histograms;
+
+		static mutex _snapshotLock;
+		static condition_variable _snapshotSignal;
+		static thread _snapshotThread;
+		static bool _snapshotRunning;
+	public:
+		static MetricCounter& GetCounter(const string& name);
+		static MetricGauge& GetGauge(const string& name);
+		static MetricHistogram& GetHistogram(const string& name);
+
+		static void Save(const string& path, MetricsFormat format = MetricsFormat::JSON);
+		static void StartSnapshots(const string& path, double interval, MetricsFormat format = MetricsFormat::JSON);
+		static void StopSnapshots();
+	private:
+		static void WriteJson(ostream& writer);
+		static void WritePrometheus(ostream& writer);
+	};
+}
@@ -73,17 +73,23 @@ void FastDetector::Match(vector<KeyPoint>& kp_1, vector<KeyPoint>& kp_2, vector<
 	auto points_2 = vector<Point2f>(); for (auto point : kp_2) points_2.push_back(point.pt);
 
 	// Find the matches
+	auto ticks = getTickCount();
     auto matchPoints = vector<Point2f>(); auto status = vector<uchar>(); auto errors = vector<float>();
     calcOpticalFlowPyrLK(_frame->GetLeft(), _frame->GetRight(), points_1, matchPoints, status, errors, Size(21, 21), 5, TermCriteria(TermCriteria::EPS | TermCriteria::COUNT, 9000, 1e-8));
+	if (_timings != nullptr) _timings->Record("flow", ticks);
 
 	// Perform radius matching with point 2
+	ticks = getTickCount();
 	FindMatches(points_2, matchPoints, output, threshold);
+	if (_timings != nullptr) _timings->Record("match", ticks);
 
 	// Filter based on optical flow error
+	ticks = getTickCount();
 	FilterOnError(status, errors, output);
 
 	// Filter based on epipolar geometry
 	EpipolarFilter(points_1, points_2, output);
+	if (_timings != nullptr) _timings->Record("match_filter", ticks);
 }
 
 /**
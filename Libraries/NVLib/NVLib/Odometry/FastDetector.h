@@ -18,6 +18,7 @@ using namespace cv;
 #include "../Model/StereoFrame.h"
 
 #include "MatchIndices.h"
+#include "TrackerTimings.h"
 
 namespace NVLib
 {
@@ -26,14 +27,17 @@ namespace NVLib
 	private:
 		int _blockSize;
 		NVLib::StereoFrame * _frame;
+		TrackerTimings * _timings;
 	public:
-		FastDetector(int blockSize) : _blockSize(blockSize) { _frame = nullptr; }
+		FastDetector(int blockSize) : _blockSize(blockSize) { _frame = nullptr; _timings = nullptr; }
 		~FastDetector() { if (_frame != nullptr) delete _frame; }
 
 		void Extract(Mat& image, vector<KeyPoint>& keypoints); 
 		void Match(vector<KeyPoint>& kp_1, vector<KeyPoint>& kp_2, vector<MatchIndices *>& output, double threshold = 1.0);
 
 		void SetFrame(Mat& image1, Mat& image2);
+
+		inline void SetTimings(TrackerTimings * timings) { _timings = timings; }
 	private:
 		int GetIndex(const Point2d& point, int blockSize, int width);
 		void FindMatches(vector<Point2f>& pointSet1, vector<Point2f>& pointSet2, vector<MatchIndices *>& matches, double threshold);
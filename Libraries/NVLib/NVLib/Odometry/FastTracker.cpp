@@ -17,10 +17,18 @@ using namespace NVLib;
  * @brief Main Constructor
  * @param camera The camera matrix that this tracker is using
  * @param firstFrame The first frame within the series
+ * @param keyframeMode Indicates that we are tracking against keyframe landmarks rather than the previous frame
+ * @param overlapThreshold The fraction of keyframe landmarks that must still be tracked before a new keyframe is inserted
  */
-FastTracker::FastTracker(Mat& camera, NVLib::DepthFrame * firstFrame) : _camera(camera), _frame(firstFrame)
+FastTracker::FastTracker(Mat& camera, NVLib::DepthFrame * firstFrame, bool keyframeMode, double overlapThreshold) : _camera(camera), _frame(firstFrame), _keyframeMode(keyframeMode), _overlapThreshold(overlapThreshold)
 {
 	_detector = new FastDetector(5); _detector->Extract(firstFrame->GetColor(), _keypoints);
+	_timings = nullptr;
+
+	_landmarkCount = 0; _trackedCount = 0; _keyframeInserted = true;
+	_keyPose = Mat_<double>::eye(4,4); _candidatePose = Mat_<double>::eye(4,4);
+
+	if (_keyframeMode) BuildLandmarks();
 }
 
 /**
@@ -44,12 +52,28 @@ FastTracker::~FastTracker()
  */
 Mat FastTracker::GetPose(NVLib::DepthFrame * frame, vector<KeyPoint>& keypoints, Vec2d& error)
 {
+	NVLIB_PROFILE_SCOPE("FastTracker::GetPose");
+
+	static auto& frameCounter = Metrics::GetCounter("fasttracker_frames");
+	static auto& matchCounts = Metrics::GetHistogram("fasttracker_matches");
+	frameCounter.Add();
+
 	// Extract the features that we need
-	_detector->Extract(frame->GetColor(), keypoints);
+	auto ticks = getTickCount();
+	{
+		NVLIB_PROFILE_SCOPE("FastTracker::Detect");
+		_detector->Extract(frame->GetColor(), keypoints);
+	}
+	if (_timings != nullptr) _timings->Record("detect", ticks);
 
 	// Find corresponding features
-	_detector->SetFrame(_frame->GetColor(), frame->GetColor());
-	auto matches = vector<MatchIndices *>(); _detector->Match(_keypoints, keypoints, matches);
+	auto matches = vector<MatchIndices *>();
+	{
+		NVLIB_PROFILE_SCOPE("FastTracker::Match");
+		_detector->SetFrame(_frame->GetColor(), frame->GetColor());
+		_detector->Match(_keypoints, keypoints, matches);
+	}
+	matchCounts.Record((int64_t)matches.size());
 
 	// DEBUG: Show the correspondences
 	//auto stereoFrame = NVLib::StereoFrame(_frame->GetColor(), frame->GetColor());
@@ -62,7 +86,11 @@ Mat FastTracker::GetPose(NVLib::DepthFrame * frame, vector<KeyPoint>& keypoints,
 	for (auto match : matches) delete match;
 
 	// Return the pose
-	return pose;
+	if (!_keyframeMode) return pose;
+
+	// In keyframe mode the estimate is relative to the keyframe, so convert it back into a frame-to-frame pose
+	_candidatePose = pose;
+	return pose * _keyPose.inv();
 }
 
 /**
@@ -74,19 +102,26 @@ Mat FastTracker::GetPose(NVLib::DepthFrame * frame, vector<KeyPoint>& keypoints,
  */
 Mat FastTracker::FindPoseProcess(vector<KeyPoint>& keypoints_2, vector<MatchIndices *>& matches, Vec2d& error) 
 {
-	// Retrieve the scene points
+	NVLIB_PROFILE_SCOPE("FastTracker::FindPoseProcess");
+
+	// Retrieve the scene points (keyframe landmarks have already been unprojected)
 	auto scenePoints = vector<Point3f>(); scenePoints.clear();
-	GetScenePoints(_camera, _frame->GetDepth(), matches, _keypoints, scenePoints);
+	if (_keyframeMode) GetLandmarkPoints(matches, scenePoints);
+	else GetScenePoints(_camera, _frame->GetDepth(), matches, _keypoints, scenePoints);
 
 	// Retrieve the image points
 	auto imagePoints = vector<Point2f>(); imagePoints.clear();
 	GetImagePoints(keypoints_2, matches, imagePoints);
 
 	// Filter the points so that they all have valid depth values
-	FilterBadDepth(scenePoints, imagePoints);
+	auto ticks = getTickCount();
+	FilterBadDepth(scenePoints, imagePoints); _trackedCount = (int)scenePoints.size();
+	if (_timings != nullptr) _timings->Record("depth_filter", ticks);
 
 	// Determine the pose value
-	Mat pose = EstimatePose(_camera, scenePoints, imagePoints);
+	ticks = getTickCount();
+	Mat pose; { NVLIB_PROFILE_SCOPE("FastTracker::EstimatePose"); pose = EstimatePose(_camera, scenePoints, imagePoints); }
+	if (_timings != nullptr) _timings->Record("pnp", ticks);
 
 	// Determine the reprojection value
 	EstimateError(_camera, pose, scenePoints, imagePoints, error);
@@ -110,26 +145,21 @@ void FastTracker::GetScenePoints(Mat& camera, Mat& depth, vector<MatchIndices *>
 		// Retrieve image points from the system
 		auto point = keypoints[match->GetFirstId()].pt;	
 
-		// Get the depth from the system
-		auto Z = ExtractDepth(depth, point);
-
-		// Handle the error case
-		if (Z <= 0) { out.push_back(Point3f()); continue; }
-
-		// Defines the parameters that make up the variables
-		auto cdata = (double *) camera.data;
-		auto fx = cdata[0]; auto fy = cdata[5];
-		auto cx = cdata[2]; auto cy = cdata[6];
-
-		// Convert to a 3D point
-		auto X = (point.x - cx) * (Z / fx);
-		auto Y = (point.y - cy) * (Z / fy);
-		
 		// Add the 3D point to the collection
-		out.push_back(Point3f(X, Y, Z)); 
+		out.push_back(UnProject(camera, depth, point)); 
 	}
 }
 
+/**
+ * @brief Retrieve the scene points of the matched keyframe landmarks
+ * @param matches The matches that were found (first id refers to the keyframe keypoints)
+ * @param out The output scene points
+ */
+void FastTracker::GetLandmarkPoints(vector<MatchIndices *>& matches, vector<Point3f>& out) 
+{
+	for (auto match : matches) out.push_back(_landmarks[match->GetFirstId()]);
+}
+
 /**
  * @brief Extract the associated image points
  * @param keypoints The key points that we are extracting from
@@ -152,6 +182,8 @@ void FastTracker::GetImagePoints(vector<KeyPoint>& keypoints, vector<MatchIndice
  */
 void FastTracker::FilterBadDepth(vector<Point3f>& scenePoints, vector<Point2f>& imagePoints) 
 {
+	static auto& invalidCounter = Metrics::GetCounter("fasttracker_invalid_depth");
+
 	// Make sure that the incoming points are "kosher" 
 	assert(scenePoints.size() == imagePoints.size());
 
@@ -163,13 +195,14 @@ void FastTracker::FilterBadDepth(vector<Point3f>& scenePoints, vector<Point2f>&
 	{
 		auto scenePoint = scenePoints[i]; auto imagePoint = imagePoints[i];
 
-		if (scenePoint.z > 300 && scenePoint.z < 2000) 
+		if (IsValidDepth(scenePoint)) 
 		{
 			ascenePoints.push_back(scenePoint); aimagePoints.push_back(imagePoint);
 		}
 	}
 
 	// Clear the incoming points
+	invalidCounter.Add((int64_t)(scenePoints.size() - ascenePoints.size()));
 	scenePoints.clear(); imagePoints.clear();
 
 	// Copy the new values into the array
@@ -199,7 +232,11 @@ Mat FastTracker::EstimatePose(Mat& camera, vector<Point3f>& scenePoints, vector<
 
 	// Perform the pose estimation
 	Mat nodistortion = Mat_<double>::zeros(4,1);
-	Vec3d rvec, tvec; solvePnPRansac(dscene, dimage, camera, nodistortion, rvec, tvec, false, 1e4, 10, 0.9, noArray(), SOLVEPNP_DLS);
+	Vec3d rvec, tvec; auto inliers = vector<int>();
+	solvePnPRansac(dscene, dimage, camera, nodistortion, rvec, tvec, false, 1e4, 10, 0.9, inliers, SOLVEPNP_DLS);
+
+	static auto& inlierCounts = Metrics::GetHistogram("fasttracker_pnp_inliers");
+	inlierCounts.Record((int64_t)inliers.size());
 
 	// Return the result
 	return NVLib::PoseUtils::Vectors2Pose(rvec, tvec);
@@ -254,14 +291,64 @@ void FastTracker::EstimateError(Mat& camera, Mat& pose, vector<Point3f>& scenePo
  * @brief Add the logic to advance to the next frame
  * @param frame The new frame that we are adding
  * @param keypoints The key points that we are adding
- * @param free Indicates whether we want to delete the value
+ * @param free Indicates whether we want to delete frames that the tracker no longer references
+ * @remark In keyframe mode the frame only replaces the keyframe when the landmark overlap drops below the threshold
  */
 void FastTracker::UpdateNextFrame(NVLib::DepthFrame * frame, vector<KeyPoint>& keypoints, bool free) 
 {
+	NVLIB_PROFILE_SCOPE("FastTracker::UpdateNextFrame");
+
+	// Keep the current keyframe while enough of its landmarks are still being tracked
+	if (_keyframeMode && GetOverlap() >= _overlapThreshold) 
+	{
+		_keyPose = _candidatePose; _keyframeInserted = false;
+		if (free && frame != _frame) delete frame;
+		return;
+	}
+
 	// Perform Previous Updating
 	if (free) delete _frame; _frame = frame; 
 	_keypoints.clear(); 
 	for (auto point : keypoints) _keypoints.push_back(point);
+
+	// Build the landmarks for the new keyframe
+	if (_keyframeMode) 
+	{
+		BuildLandmarks();
+		_keyPose = Mat_<double>::eye(4,4); _candidatePose = Mat_<double>::eye(4,4);
+		_keyframeInserted = true;
+	}
+}
+
+//--------------------------------------------------
+// Keyframe Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the fraction of the reference points that were tracked into the last frame
+ * @return double The overlap ratio (0 if there are no valid reference points)
+ */
+double FastTracker::GetOverlap() 
+{
+	auto total = _keyframeMode ? _landmarkCount : (int)_keypoints.size();
+	if (total <= 0) return 0;
+	return (double)_trackedCount / (double)total;
+}
+
+/**
+ * @brief Unproject the keypoints of the current keyframe into 3D landmarks
+ * @remark Landmarks without a valid depth are kept (as zero points) so that the keypoint indices still line up
+ */
+void FastTracker::BuildLandmarks() 
+{
+	_landmarks.clear(); _landmarkCount = 0; _trackedCount = 0;
+
+	for (auto& keypoint : _keypoints) 
+	{
+		auto landmark = UnProject(_camera, _frame->GetDepth(), keypoint.pt);
+		if (IsValidDepth(landmark)) _landmarkCount++;
+		_landmarks.push_back(landmark);
+	}
 }
 
 //--------------------------------------------------
@@ -282,6 +369,44 @@ float FastTracker::ExtractDepth(Mat& depth, const Point2f& location)
 	return data[index];
 }
 
+/**
+ * @brief Convert an image point into a 3D point using the depth map
+ * @param camera The given camera matrix
+ * @param depth The depth map that we are looking up
+ * @param point The image point that we are converting
+ * @return Point3f The resultant 3D point (a zero point if the depth is missing)
+ */
+Point3f FastTracker::UnProject(Mat& camera, Mat& depth, const Point2f& point) 
+{
+	// Get the depth from the system
+	auto Z = ExtractDepth(depth, point);
+
+	// Handle the error case
+	if (Z <= 0) return Point3f();
+
+	// Defines the parameters that make up the variables
+	auto cdata = (double *) camera.data;
+	auto fx = cdata[0]; auto fy = cdata[4];
+	auto cx = cdata[2]; auto cy = cdata[5];
+
+	// Convert to a 3D point
+	auto X = (point.x - cx) * (Z / fx);
+	auto Y = (point.y - cy) * (Z / fy);
+
+	return Point3f(X, Y, Z);
+}
+
+/**
+ * @brief Determine whether a scene point lies within the trusted depth range
+ * @param point The point that we are checking
+ * @return true The depth is usable
+ * @return false The depth is missing or out of range
+ */
+bool FastTracker::IsValidDepth(const Point3f& point) 
+{
+	return point.z > 300 && point.z < 2000;
+}
+
 /**
  * @brief Show the set of corresponding points wrt the system
  * @param frame The stereo frame
@@ -15,6 +15,8 @@ using namespace std;
 using namespace cv;
 
 #include "../PoseUtils.h"
+#include "../Profiler.h"
+#include "../Metrics.h"
 #include "../DisplayUtils.h"
 #include "../Model/DepthFrame.h"
 #include "../Model/StereoFrame.h"
@@ -31,19 +33,40 @@ namespace NVLib
 		NVLib::DepthFrame * _frame;
 		vector<KeyPoint> _keypoints;
 		FastDetector * _detector;
+
+		bool _keyframeMode;
+		double _overlapThreshold;
+		vector<Point3f> _landmarks;
+		int _landmarkCount;
+		int _trackedCount;
+		Mat _keyPose;
+		Mat _candidatePose;
+		bool _keyframeInserted;
+		TrackerTimings * _timings;
 	public:
-		FastTracker(Mat& camera, NVLib::DepthFrame * firstFrame);
+		FastTracker(Mat& camera, NVLib::DepthFrame * firstFrame, bool keyframeMode = false, double overlapThreshold = 0.5);
 		~FastTracker();
 
 		Mat GetPose(NVLib::DepthFrame * frame, vector<KeyPoint>& keypoints, Vec2d& error);
 
 		void UpdateNextFrame(NVLib::DepthFrame * frame, vector<KeyPoint>& keypoints, bool free);
 
+		double GetOverlap();
+
 		inline NVLib::DepthFrame *& GetFrame() { return _frame; }
 		inline vector<KeyPoint>& GetKeypoints() { return _keypoints; }
+		inline bool GetKeyframeMode() { return _keyframeMode; }
+		inline vector<Point3f>& GetLandmarks() { return _landmarks; }
+		inline bool GetKeyframeInserted() { return _keyframeInserted; }
+		inline TrackerTimings * GetTimings() { return _timings; }
+		inline void SetTimings(TrackerTimings * timings) { _timings = timings; _detector->SetTimings(timings); }
 	private:
 		Mat FindPoseProcess(vector<KeyPoint>& keypoints_2, vector<MatchIndices *>& matches, Vec2d& error);
 		void GetScenePoints(Mat& camera, Mat& depth, vector<MatchIndices *>& matches, vector<KeyPoint>& keypoints, vector<Point3f>& out);
+		void GetLandmarkPoints(vector<MatchIndices *>& matches, vector<Point3f>& out);
+		void BuildLandmarks();
+		Point3f UnProject(Mat& camera, Mat& depth, const Point2f& point);
+		bool IsValidDepth(const Point3f& point);
 		void GetImagePoints(vector<KeyPoint>& keypoints, vector<MatchIndices *>& matches, vector<Point2f>& out);
 		void FilterBadDepth(vector<Point3f>& scenePoints, vector<Point2f>& imagePoints);
 		Mat EstimatePose(Mat& camera, vector<Point3f>& scenePoints, vector<Point2f>& imagePoints);	
@@ -0,0 +1,336 @@
+//--------------------------------------------------
+// Implementation of class IcpTracker
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "IcpTracker.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Constructors
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param camera The camera matrix that this tracker is using
+ * @param firstFrame The first frame within the series
+ * @param levels The number of levels within the depth pyramid
+ * @param distanceThreshold The maximum distance between associated points (in depth map units)
+ * @param normalThreshold The minimum cosine between associated normals
+ */
+IcpTracker::IcpTracker(Mat& camera, NVLib::DepthFrame * firstFrame, int levels, double distanceThreshold, double normalThreshold) :
+	_camera(camera), _frame(firstFrame), _levels(levels), _distanceThreshold(distanceThreshold), _normalThreshold(normalThreshold)
+{
+	if (_levels <= 0) throw runtime_error("The ICP tracker requires at least one pyramid level");
+
+	// Coarse levels are cheap, so they get the most iterations
+	for (auto level = 0; level < _levels; level++) _iterations.push_back(4 + 3 * level);
+
+	// Split the image into enough strips to keep all the cores busy
+	_strips = std::max(4, cv::getNumThreads() * 4);
+
+	// Setup the camera matrices for each level
+	for (auto level = 0; level < _levels; level++) _cameras.push_back(PyramidUtils::ScaleCamera(camera, level));
+
+	// Build the reference pyramid
+	BuildPyramid(firstFrame->GetDepth(), _vertices, _normals);
+	_nextFrame = nullptr;
+}
+
+//--------------------------------------------------
+// Estimate Pose
+//--------------------------------------------------
+
+/**
+ * @brief Estimate the pose of the next frame relative to the current frame
+ * @param frame The frame that we are getting the pose from
+ * @param error The output point-to-plane error (mean, standard deviation)
+ * @return Mat The pose that maps points in the current frame into the new frame
+ */
+Mat IcpTracker::GetPose(NVLib::DepthFrame * frame, Vec2d& error)
+{
+	// Build the pyramid for the new frame (this is kept so that we don't rebuild it when advancing)
+	BuildPyramid(frame->GetDepth(), _nextVertices, _nextNormals); _nextFrame = frame;
+
+	// The transform maps points from the new frame into the reference frame
+	Mat transform = Mat_<double>::eye(4,4); Mat system;
+
+	// Perform the coarse-to-fine refinement
+	for (auto level = _levels - 1; level >= 0; level--)
+	{
+		for (auto iteration = 0; iteration < _iterations[level]; iteration++)
+		{
+			auto count = Accumulate(level, transform, system);
+			if (count < 6) break;
+			if (!SolveUpdate(system, transform)) break;
+		}
+	}
+
+	// Determine the residual error at the finest level
+	Accumulate(0, transform, system); GetError(system, error);
+
+	// Return the pose in the same sense as the feature tracker
+	return transform.inv();
+}
+
+//--------------------------------------------------
+// UpdateNextFrame
+//--------------------------------------------------
+
+/**
+ * @brief Add the logic to advance to the next frame
+ * @param frame The new frame that we are adding
+ * @param free Indicates whether we want to delete the previous frame
+ */
+void IcpTracker::UpdateNextFrame(NVLib::DepthFrame * frame, bool free)
+{
+	// Perform Previous Updating
+	if (free) delete _frame; _frame = frame;
+
+	// Reuse the pyramid from the pose estimation if it belongs to this frame
+	if (frame == _nextFrame)
+	{
+		std::swap(_vertices, _nextVertices); std::swap(_normals, _nextNormals);
+	}
+	else BuildPyramid(frame->GetDepth(), _vertices, _normals);
+
+	_nextFrame = nullptr;
+}
+
+//--------------------------------------------------
+// Pyramid Construction
+//--------------------------------------------------
+
+/**
+ * @brief Build the vertex and normal pyramids for a given depth map
+ * @param depth The depth map that we are building from
+ * @param vertices The output vertex maps (finest level first)
+ * @param normals The output normal maps (finest level first)
+ */
+void IcpTracker::BuildPyramid(Mat& depth, vector<Mat>& vertices, vector<Mat>& normals)
+{
+	vertices.clear(); normals.clear();
+
+	Mat current; if (depth.type() == CV_32FC1) current = depth; else depth.convertTo(current, CV_32F);
+
+	for (auto level = 0; level < _levels; level++)
+	{
+		if (level > 0) current = PyramidUtils::DownsampleDepth(current);
+
+		Mat vertexMap = BuildVertexMap(_cameras[level], current);
+		vertices.push_back(vertexMap);
+		normals.push_back(BuildNormalMap(vertexMap));
+	}
+}
+
+/**
+ * @brief Convert an organised depth map into a map of 3D points
+ * @param camera The camera matrix for this level
+ * @param depth The depth map that we are converting
+ * @return Mat A 3 channel float map (a zero Z indicates a missing point)
+ */
+Mat IcpTracker::BuildVertexMap(Mat& camera, Mat& depth)
+{
+	Mat result = Mat_<Vec3f>::zeros(depth.size());
+
+	auto cdata = (double *) camera.data;
+	auto fx = cdata[0]; auto fy = cdata[4];
+	auto cx = cdata[2]; auto cy = cdata[5];
+
+	parallel_for_(Range(0, depth.rows), [&](const Range& range)
+	{
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto input = depth.ptr<float>(row); auto output = result.ptr<Vec3f>(row);
+
+			for (auto column = 0; column < depth.cols; column++)
+			{
+				auto Z = input[column]; if (Z <= 0) continue;
+				output[column] = Vec3f((column - cx) * (Z / fx), (row - cy) * (Z / fy), Z);
+			}
+		}
+	});
+
+	return result;
+}
+
+/**
+ * @brief Calculate the normals of an organised vertex map using neighbouring points
+ * @param vertices The vertex map that we are finding normals for
+ * @return Mat A 3 channel float map of unit normals pointing toward the camera (zero if unknown)
+ */
+Mat IcpTracker::BuildNormalMap(Mat& vertices)
+{
+	Mat result = Mat_<Vec3f>::zeros(vertices.size());
+
+	parallel_for_(Range(0, vertices.rows - 1), [&](const Range& range)
+	{
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto current = vertices.ptr<Vec3f>(row); auto below = vertices.ptr<Vec3f>(row + 1);
+			auto output = result.ptr<Vec3f>(row);
+
+			for (auto column = 0; column < vertices.cols - 1; column++)
+			{
+				auto& point = current[column]; auto& right = current[column + 1]; auto& down = below[column];
+				if (point[2] <= 0 || right[2] <= 0 || down[2] <= 0) continue;
+
+				auto normal = (right - point).cross(down - point);
+				auto length = sqrt(normal.dot(normal)); if (length <= 0) continue;
+				normal = normal / length;
+
+				// Make sure that the normal points back toward the camera
+				if (normal.dot(point) > 0) normal = normal * -1.0f;
+
+				output[column] = normal;
+			}
+		}
+	});
+
+	return result;
+}
+
+//--------------------------------------------------
+// Linear System
+//--------------------------------------------------
+
+/**
+ * @brief Build the point-to-plane normal equations using projective data association
+ * @param level The pyramid level that we are working on
+ * @param transform The current estimate of the transform from the new frame into the reference frame
+ * @param system The output system (upper JtJ, Jtr and error sums)
+ * @return int The number of associated points
+ */
+int IcpTracker::Accumulate(int level, Mat& transform, Mat& system)
+{
+	auto& sourceVertices = _nextVertices[level]; auto& sourceNormals = _nextNormals[level];
+	auto& targetVertices = _vertices[level]; auto& targetNormals = _normals[level];
+
+	auto cdata = (double *) _cameras[level].data;
+	auto fx = cdata[0]; auto fy = cdata[4];
+	auto cx = cdata[2]; auto cy = cdata[5];
+
+	auto t = (double *) transform.data;
+	auto distance2 = _distanceThreshold * _distanceThreshold;
+
+	// Each strip of rows is reduced into its own row of partial sums
+	Mat partials = Mat_<double>::zeros(_strips, SYSTEM_SIZE);
+
+	parallel_for_(Range(0, _strips), [&](const Range& range)
+	{
+		for (auto strip = range.start; strip < range.end; strip++)
+		{
+			auto rowStart = strip * sourceVertices.rows / _strips;
+			auto rowEnd = (strip + 1) * sourceVertices.rows / _strips;
+			auto output = partials.ptr<double>(strip);
+
+			double J[6];
+
+			for (auto row = rowStart; row < rowEnd; row++)
+			{
+				auto vertexRow = sourceVertices.ptr<Vec3f>(row); auto normalRow = sourceNormals.ptr<Vec3f>(row);
+
+				for (auto column = 0; column < sourceVertices.cols; column++)
+				{
+					auto& v = vertexRow[column]; if (v[2] <= 0) continue;
+
+					// Transform the point into the reference frame
+					auto px = t[0] * v[0] + t[1] * v[1] + t[2] * v[2] + t[3];
+					auto py = t[4] * v[0] + t[5] * v[1] + t[6] * v[2] + t[7];
+					auto pz = t[8] * v[0] + t[9] * v[1] + t[10] * v[2] + t[11];
+					if (pz <= 0) continue;
+
+					// Projective data association
+					auto u = (int)round(fx * px / pz + cx); auto w = (int)round(fy * py / pz + cy);
+					if (u < 0 || w < 0 || u >= targetVertices.cols || w >= targetVertices.rows) continue;
+
+					auto& q = targetVertices.ptr<Vec3f>(w)[u]; auto& n = targetNormals.ptr<Vec3f>(w)[u];
+					if (q[2] <= 0 || (n[0] == 0 && n[1] == 0 && n[2] == 0)) continue;
+
+					// Reject associations that are too far apart
+					auto dx = px - q[0]; auto dy = py - q[1]; auto dz = pz - q[2];
+					if (dx * dx + dy * dy + dz * dz > distance2) continue;
+
+					// Reject associations whose surfaces point in different directions
+					auto& ns = normalRow[column];
+					auto nx = t[0] * ns[0] + t[1] * ns[1] + t[2] * ns[2];
+					auto ny = t[4] * ns[0] + t[5] * ns[1] + t[6] * ns[2];
+					auto nz = t[8] * ns[0] + t[9] * ns[1] + t[10] * ns[2];
+					if (nx * n[0] + ny * n[1] + nz * n[2] < _normalThreshold) continue;
+
+					// Point-to-plane residual and its derivative wrt (rotation, translation)
+					auto residual = n[0] * dx + n[1] * dy + n[2] * dz;
+					J[0] = py * n[2] - pz * n[1]; J[1] = pz * n[0] - px * n[2]; J[2] = px * n[1] - py * n[0];
+					J[3] = n[0]; J[4] = n[1]; J[5] = n[2];
+
+					auto index = 0;
+					for (auto i = 0; i < 6; i++)
+					{
+						for (auto j = i; j < 6; j++) output[index++] += J[i] * J[j];
+						output[SYSTEM_B + i] += J[i] * residual;
+					}
+
+					output[SYSTEM_SQUARE_SUM] += residual * residual;
+					output[SYSTEM_ABS_SUM] += abs(residual);
+					output[SYSTEM_COUNT] += 1;
+				}
+			}
+		}
+	});
+
+	// Reduce the strips into a single system
+	reduce(partials, system, 0, REDUCE_SUM);
+
+	return (int)system.at<double>(0, SYSTEM_COUNT);
+}
+
+/**
+ * @brief Solve the normal equations and apply the update to the transform
+ * @param system The accumulated system
+ * @param transform The transform that we are updating
+ * @return true The update was applied
+ * @return false The system could not be solved or the update was negligible
+ */
+bool IcpTracker::SolveUpdate(Mat& system, Mat& transform)
+{
+	auto input = (double *) system.data;
+
+	// Unpack the symmetric system
+	Mat A = Mat_<double>(6,6); Mat b = Mat_<double>(6,1);
+	auto adata = (double *) A.data; auto bdata = (double *) b.data;
+
+	auto index = 0;
+	for (auto i = 0; i < 6; i++)
+	{
+		for (auto j = i; j < 6; j++) { adata[i * 6 + j] = input[index]; adata[j * 6 + i] = input[index]; index++; }
+		bdata[i] = -input[SYSTEM_B + i];
+	}
+
+	// Solve for the update
+	Mat x; if (!solve(A, b, x, DECOMP_CHOLESKY)) return false;
+	auto xdata = (double *) x.data;
+
+	// Apply the update on the left
+	Mat update = PoseUtils::Vectors2Pose(Vec3d(xdata[0], xdata[1], xdata[2]), Vec3d(xdata[3], xdata[4], xdata[5]));
+	transform = update * transform;
+
+	return norm(x) > 1e-8;
+}
+
+/**
+ * @brief Extract the residual summary from the system
+ * @param system The accumulated system
+ * @param error The output error (mean, standard deviation)
+ */
+void IcpTracker::GetError(Mat& system, Vec2d& error)
+{
+	auto input = (double *) system.data; auto count = input[SYSTEM_COUNT];
+	if (count <= 0) { error = Vec2d(0, 0); return; }
+
+	auto mean = input[SYSTEM_ABS_SUM] / count;
+	auto variance = input[SYSTEM_SQUARE_SUM] / count - mean * mean;
+	error[0] = mean; error[1] = sqrt(std::max(0.0, variance));
+}
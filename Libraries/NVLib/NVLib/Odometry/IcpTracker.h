@@ -0,0 +1,68 @@
+//--------------------------------------------------
+// Defines a tracker that uses dense depth (point-to-plane ICP) for pose estimation
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "../PoseUtils.h"
+#include "../Model/DepthFrame.h"
+
+#include "PyramidUtils.h"
+
+namespace NVLib
+{
+	class IcpTracker
+	{
+	private:
+
+		/* Constant: the layout of an accumulated system (upper triangle of JtJ, Jtr and the error sums) */
+		inline static const int SYSTEM_SIZE = 30;
+		inline static const int SYSTEM_B = 21;
+		inline static const int SYSTEM_SQUARE_SUM = 27;
+		inline static const int SYSTEM_ABS_SUM = 28;
+		inline static const int SYSTEM_COUNT = 29;
+
+	private:
+		Mat _camera;
+		NVLib::DepthFrame * _frame;
+		int _levels;
+		int _strips;
+		double _distanceThreshold;
+		double _normalThreshold;
+		vector<int> _iterations;
+		vector<Mat> _cameras;
+		vector<Mat> _vertices;
+		vector<Mat> _normals;
+		vector<Mat> _nextVertices;
+		vector<Mat> _nextNormals;
+		NVLib::DepthFrame * _nextFrame;
+	public:
+		IcpTracker(Mat& camera, NVLib::DepthFrame * firstFrame, int levels = 3, double distanceThreshold = 50, double normalThreshold = 0.8);
+
+		Mat GetPose(NVLib::DepthFrame * frame, Vec2d& error);
+
+		void UpdateNextFrame(NVLib::DepthFrame * frame, bool free);
+
+		inline NVLib::DepthFrame *& GetFrame() { return _frame; }
+		inline vector<int>& GetIterations() { return _iterations; }
+		inline int& GetStrips() { return _strips; }
+	private:
+		void BuildPyramid(Mat& depth, vector<Mat>& vertices, vector<Mat>& normals);
+		Mat BuildVertexMap(Mat& camera, Mat& depth);
+		Mat BuildNormalMap(Mat& vertices);
+
+		int Accumulate(int level, Mat& transform, Mat& system);
+		bool SolveUpdate(Mat& system, Mat& transform);
+		void GetError(Mat& system, Vec2d& error);
+	};
+}
@@ -0,0 +1,329 @@
+//--------------------------------------------------
+// Implementation of class PhotoTracker
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "PhotoTracker.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Constructors
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param camera The camera matrix that this tracker is using
+ * @param firstFrame The first frame within the series
+ * @param levels The number of levels within the image pyramid
+ * @param huber The intensity residual beyond which the Huber weighting kicks in
+ */
+PhotoTracker::PhotoTracker(Mat& camera, NVLib::DepthFrame * firstFrame, int levels, double huber) :
+	_camera(camera), _frame(firstFrame), _levels(levels), _huber(huber)
+{
+	if (_levels <= 0) throw runtime_error("The photometric tracker requires at least one pyramid level");
+
+	// Coarse levels are cheap, so they get the most iterations
+	for (auto level = 0; level < _levels; level++) _iterations.push_back(5 + 5 * level);
+
+	// Split the points into enough strips to keep all the cores busy
+	_strips = std::max(4, cv::getNumThreads() * 4);
+
+	// Setup the camera matrices for each level
+	for (auto level = 0; level < _levels; level++) _cameras.push_back(PyramidUtils::ScaleCamera(camera, level));
+
+	// Prepare the reference frame
+	BuildImagePyramid(firstFrame->GetColor(), _images);
+	Precompute(firstFrame->GetDepth());
+	_nextFrame = nullptr;
+}
+
+//--------------------------------------------------
+// Estimate Pose
+//--------------------------------------------------
+
+/**
+ * @brief Estimate the pose of the next frame relative to the current frame
+ * @param frame The frame that we are getting the pose from
+ * @param error The output intensity error (mean, standard deviation)
+ * @return Mat The pose that maps points in the current frame into the new frame
+ */
+Mat PhotoTracker::GetPose(NVLib::DepthFrame * frame, Vec2d& error)
+{
+	// Build the image pyramid for the new frame (this is kept so that we don't rebuild it when advancing)
+	BuildImagePyramid(frame->GetColor(), _nextImages); _nextFrame = frame;
+
+	// The transform maps the reference points into the new frame
+	Mat transform = Mat_<double>::eye(4,4); Mat system;
+
+	// Perform the coarse-to-fine refinement
+	for (auto level = _levels - 1; level >= 0; level--)
+	{
+		for (auto iteration = 0; iteration < _iterations[level]; iteration++)
+		{
+			auto count = Accumulate(level, transform, system);
+			if (count < 6) break;
+			if (!SolveUpdate(system, transform)) break;
+		}
+	}
+
+	// Determine the residual error at the finest level
+	Accumulate(0, transform, system); GetError(system, error);
+
+	// Return the result
+	return transform;
+}
+
+//--------------------------------------------------
+// UpdateNextFrame
+//--------------------------------------------------
+
+/**
+ * @brief Add the logic to advance to the next frame
+ * @param frame The new frame that we are adding
+ * @param free Indicates whether we want to delete the previous frame
+ */
+void PhotoTracker::UpdateNextFrame(NVLib::DepthFrame * frame, bool free)
+{
+	// Perform Previous Updating
+	if (free) delete _frame; _frame = frame;
+
+	// Reuse the image pyramid from the pose estimation if it belongs to this frame
+	if (frame == _nextFrame) std::swap(_images, _nextImages);
+	else BuildImagePyramid(frame->GetColor(), _images);
+
+	// The jacobians only depend on the reference frame, so they are calculated once here
+	Precompute(frame->GetDepth());
+	_nextFrame = nullptr;
+}
+
+//--------------------------------------------------
+// Reference Frame Preparation
+//--------------------------------------------------
+
+/**
+ * @brief Build an intensity pyramid for the given color image
+ * @param color The color image that we are building from
+ * @param images The output intensity images (finest level first)
+ */
+void PhotoTracker::BuildImagePyramid(Mat& color, vector<Mat>& images)
+{
+	images.clear();
+
+	Mat current = PyramidUtils::GetGrayImage(color);
+
+	for (auto level = 0; level < _levels; level++)
+	{
+		if (level > 0) current = PyramidUtils::DownsampleImage(current);
+		images.push_back(current);
+	}
+}
+
+/**
+ * @brief Precompute the reference points, intensities and jacobians for every level
+ * @param depth The depth map of the reference frame
+ */
+void PhotoTracker::Precompute(Mat& depth)
+{
+	_points.clear(); _intensities.clear(); _jacobians.clear();
+
+	Mat current; if (depth.type() == CV_32FC1) current = depth; else depth.convertTo(current, CV_32F);
+
+	for (auto level = 0; level < _levels; level++)
+	{
+		if (level > 0) current = PyramidUtils::DownsampleDepth(current);
+		PrecomputeLevel(level, current);
+	}
+}
+
+/**
+ * @brief Precompute the packed per-pixel data for a single level
+ * @param level The level that we are processing
+ * @param depth The depth map at this level
+ * @remark The inverse compositional formulation means the jacobian only depends on the reference image
+ */
+void PhotoTracker::PrecomputeLevel(int level, Mat& depth)
+{
+	auto& image = _images[level];
+
+	// Find the intensity gradients (Scharr needs to be normalised to get per-pixel gradients)
+	Mat gradientX = ImageUtils::GetGradientX(image) / 32.0;
+	Mat gradientY = ImageUtils::GetGradientY(image) / 32.0;
+
+	auto cdata = (double *) _cameras[level].data;
+	auto fx = cdata[0]; auto fy = cdata[4];
+	auto cx = cdata[2]; auto cy = cdata[5];
+
+	// Count the usable pixels so that the packed arrays are only allocated once
+	auto count = 0;
+	for (auto row = 1; row < depth.rows - 1; row++)
+	{
+		auto input = depth.ptr<float>(row);
+		for (auto column = 1; column < depth.cols - 1; column++) if (input[column] > 0) count++;
+	}
+
+	Mat points = Mat_<float>(count, 3); Mat intensities = Mat_<float>(count, 1); Mat jacobians = Mat_<float>(count, 6);
+	auto pdata = (float *) points.data; auto idata = (float *) intensities.data; auto jdata = (float *) jacobians.data;
+
+	auto index = 0;
+	for (auto row = 1; row < depth.rows - 1; row++)
+	{
+		auto depthRow = depth.ptr<float>(row); auto imageRow = image.ptr<float>(row);
+		auto gxRow = gradientX.ptr<float>(row); auto gyRow = gradientY.ptr<float>(row);
+
+		for (auto column = 1; column < depth.cols - 1; column++)
+		{
+			auto Z = depthRow[column]; if (Z <= 0) continue;
+			auto X = (column - cx) * (Z / fx); auto Y = (row - cy) * (Z / fy);
+
+			// The derivative of the intensity wrt the 3D point
+			auto a = gxRow[column] * fx / Z; auto b = gyRow[column] * fy / Z;
+			auto c = -(a * X + b * Y) / Z;
+
+			pdata[index * 3 + 0] = X; pdata[index * 3 + 1] = Y; pdata[index * 3 + 2] = Z;
+			idata[index] = imageRow[column];
+
+			// Chain through the derivative of the point wrt (rotation, translation)
+			auto J = jdata + index * 6;
+			J[0] = Y * c - Z * b; J[1] = Z * a - X * c; J[2] = X * b - Y * a;
+			J[3] = a; J[4] = b; J[5] = c;
+
+			index++;
+		}
+	}
+
+	_points.push_back(points); _intensities.push_back(intensities); _jacobians.push_back(jacobians);
+}
+
+//--------------------------------------------------
+// Linear System
+//--------------------------------------------------
+
+/**
+ * @brief Build the weighted normal equations for the intensity residuals
+ * @param level The pyramid level that we are working on
+ * @param transform The current estimate of the transform from the reference frame into the new frame
+ * @param system The output system (upper JtJ, Jtr and error sums)
+ * @return int The number of points that landed within the new image
+ */
+int PhotoTracker::Accumulate(int level, Mat& transform, Mat& system)
+{
+	auto& image = _nextImages[level];
+	auto pointCount = _points[level].rows;
+
+	auto pdata = (float *) _points[level].data;
+	auto idata = (float *) _intensities[level].data;
+	auto jdata = (float *) _jacobians[level].data;
+
+	auto cdata = (double *) _cameras[level].data;
+	auto fx = cdata[0]; auto fy = cdata[4];
+	auto cx = cdata[2]; auto cy = cdata[5];
+
+	auto t = (double *) transform.data;
+	auto maxU = image.cols - 1.0; auto maxV = image.rows - 1.0;
+
+	// Each strip of points is reduced into its own row of partial sums
+	Mat partials = Mat_<double>::zeros(_strips, SYSTEM_SIZE);
+
+	parallel_for_(Range(0, _strips), [&](const Range& range)
+	{
+		for (auto strip = range.start; strip < range.end; strip++)
+		{
+			auto start = strip * pointCount / _strips; auto end = (strip + 1) * pointCount / _strips;
+			auto output = partials.ptr<double>(strip);
+
+			for (auto i = start; i < end; i++)
+			{
+				auto p = pdata + i * 3;
+
+				// Warp the reference point into the new frame
+				auto px = t[0] * p[0] + t[1] * p[1] + t[2] * p[2] + t[3];
+				auto py = t[4] * p[0] + t[5] * p[1] + t[6] * p[2] + t[7];
+				auto pz = t[8] * p[0] + t[9] * p[1] + t[10] * p[2] + t[11];
+				if (pz <= 0) continue;
+
+				auto u = fx * px / pz + cx; auto v = fy * py / pz + cy;
+				if (u < 0 || v < 0 || u >= maxU || v >= maxV) continue;
+
+				// Bilinear interpolation of the new image
+				auto x0 = (int)u; auto y0 = (int)v; auto dx = u - x0; auto dy = v - y0;
+				auto top = image.ptr<float>(y0) + x0; auto bottom = image.ptr<float>(y0 + 1) + x0;
+				auto intensity = (1 - dy) * ((1 - dx) * top[0] + dx * top[1]) + dy * ((1 - dx) * bottom[0] + dx * bottom[1]);
+
+				// Huber weighted residual
+				auto residual = intensity - idata[i];
+				auto magnitude = abs(residual);
+				auto weight = magnitude <= _huber ? 1.0 : _huber / magnitude;
+
+				auto J = jdata + i * 6;
+
+				auto index = 0;
+				for (auto r = 0; r < 6; r++)
+				{
+					auto wJ = weight * J[r];
+					for (auto c = r; c < 6; c++) output[index++] += wJ * J[c];
+					output[SYSTEM_B + r] += wJ * residual;
+				}
+
+				output[SYSTEM_SQUARE_SUM] += residual * residual;
+				output[SYSTEM_ABS_SUM] += magnitude;
+				output[SYSTEM_COUNT] += 1;
+			}
+		}
+	});
+
+	// Reduce the strips into a single system
+	reduce(partials, system, 0, REDUCE_SUM);
+
+	return (int)system.at<double>(0, SYSTEM_COUNT);
+}
+
+/**
+ * @brief Solve the normal equations and apply the inverse compositional update
+ * @param system The accumulated system
+ * @param transform The transform that we are updating
+ * @return true The update was applied
+ * @return false The system could not be solved or the update was negligible
+ */
+bool PhotoTracker::SolveUpdate(Mat& system, Mat& transform)
+{
+	auto input = (double *) system.data;
+
+	// Unpack the symmetric system
+	Mat A = Mat_<double>(6,6); Mat b = Mat_<double>(6,1);
+	auto adata = (double *) A.data; auto bdata = (double *) b.data;
+
+	auto index = 0;
+	for (auto i = 0; i < 6; i++)
+	{
+		for (auto j = i; j < 6; j++) { adata[i * 6 + j] = input[index]; adata[j * 6 + i] = input[index]; index++; }
+		bdata[i] = input[SYSTEM_B + i];
+	}
+
+	// Solve for the update
+	Mat x; if (!solve(A, b, x, DECOMP_CHOLESKY)) return false;
+	auto xdata = (double *) x.data;
+
+	// The update is defined on the reference frame, so its inverse is applied on the right
+	Mat update = PoseUtils::Vectors2Pose(Vec3d(xdata[0], xdata[1], xdata[2]), Vec3d(xdata[3], xdata[4], xdata[5]));
+	transform = transform * update.inv();
+
+	return norm(x) > 1e-8;
+}
+
+/**
+ * @brief Extract the residual summary from the system
+ * @param system The accumulated system
+ * @param error The output error (mean, standard deviation)
+ */
+void PhotoTracker::GetError(Mat& system, Vec2d& error)
+{
+	auto input = (double *) system.data; auto count = input[SYSTEM_COUNT];
+	if (count <= 0) { error = Vec2d(0, 0); return; }
+
+	auto mean = input[SYSTEM_ABS_SUM] / count;
+	auto variance = input[SYSTEM_SQUARE_SUM] / count - mean * mean;
+	error[0] = mean; error[1] = sqrt(std::max(0.0, variance));
+}
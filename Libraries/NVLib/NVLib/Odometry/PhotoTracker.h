@@ -0,0 +1,69 @@
+//--------------------------------------------------
+// Defines a tracker that uses direct photometric alignment (RGB-D) for pose estimation
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "../PoseUtils.h"
+#include "../ImageUtils.h"
+#include "../Model/DepthFrame.h"
+
+#include "PyramidUtils.h"
+
+namespace NVLib
+{
+	class PhotoTracker
+	{
+	private:
+
+		/* Constant: the layout of an accumulated system (upper triangle of JtJ, Jtr and the error sums) */
+		inline static const int SYSTEM_SIZE = 30;
+		inline static const int SYSTEM_B = 21;
+		inline static const int SYSTEM_SQUARE_SUM = 27;
+		inline static const int SYSTEM_ABS_SUM = 28;
+		inline static const int SYSTEM_COUNT = 29;
+
+	private:
+		Mat _camera;
+		NVLib::DepthFrame * _frame;
+		int _levels;
+		int _strips;
+		double _huber;
+		vector<int> _iterations;
+		vector<Mat> _cameras;
+		vector<Mat> _images;
+		vector<Mat> _points;
+		vector<Mat> _intensities;
+		vector<Mat> _jacobians;
+		vector<Mat> _nextImages;
+		NVLib::DepthFrame * _nextFrame;
+	public:
+		PhotoTracker(Mat& camera, NVLib::DepthFrame * firstFrame, int levels = 4, double huber = 10);
+
+		Mat GetPose(NVLib::DepthFrame * frame, Vec2d& error);
+
+		void UpdateNextFrame(NVLib::DepthFrame * frame, bool free);
+
+		inline NVLib::DepthFrame *& GetFrame() { return _frame; }
+		inline vector<int>& GetIterations() { return _iterations; }
+		inline int& GetStrips() { return _strips; }
+	private:
+		void BuildImagePyramid(Mat& color, vector<Mat>& images);
+		void Precompute(Mat& depth);
+		void PrecomputeLevel(int level, Mat& depth);
+
+		int Accumulate(int level, Mat& transform, Mat& system);
+		bool SolveUpdate(Mat& system, Mat& transform);
+		void GetError(Mat& system, Vec2d& error);
+	};
+}
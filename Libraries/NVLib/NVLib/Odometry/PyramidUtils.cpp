@@ -0,0 +1,89 @@
+//--------------------------------------------------
+// Implementation of class PyramidUtils
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "PyramidUtils.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Downsampling
+//--------------------------------------------------
+
+/**
+ * @brief Halve the resolution of a depth map, ignoring missing depth values
+ * @param depth The depth map that we are downsampling (float)
+ * @return Mat The resultant depth map
+ */
+Mat PyramidUtils::DownsampleDepth(Mat& depth)
+{
+	Mat result = Mat_<float>::zeros(depth.rows / 2, depth.cols / 2);
+
+	for (auto row = 0; row < result.rows; row++)
+	{
+		auto top = depth.ptr<float>(row * 2); auto bottom = depth.ptr<float>(row * 2 + 1);
+		auto output = result.ptr<float>(row);
+
+		for (auto column = 0; column < result.cols; column++)
+		{
+			auto values = Vec4f(top[column * 2], top[column * 2 + 1], bottom[column * 2], bottom[column * 2 + 1]);
+
+			auto total = 0.0f; auto count = 0;
+			for (auto i = 0; i < 4; i++) if (values[i] > 0) { total += values[i]; count++; }
+
+			output[column] = count == 0 ? 0.0f : total / count;
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @brief Halve the resolution of an image by averaging 2x2 blocks
+ * @param image The image that we are downsampling
+ * @return Mat The resultant image (the same size as the matching depth level)
+ */
+Mat PyramidUtils::DownsampleImage(Mat& image)
+{
+	Mat result; resize(image, result, Size(image.cols / 2, image.rows / 2), 0, 0, INTER_AREA);
+	return result;
+}
+
+//--------------------------------------------------
+// Camera
+//--------------------------------------------------
+
+/**
+ * @brief Scale the camera matrix to the resolution of a pyramid level
+ * @param camera The full resolution camera matrix
+ * @param level The level that we want the camera matrix for
+ * @return Mat The resultant camera matrix
+ */
+Mat PyramidUtils::ScaleCamera(Mat& camera, int level)
+{
+	auto cdata = (double *) camera.data; auto scale = 1.0 / (1 << level);
+
+	auto fx = cdata[0] * scale; auto fy = cdata[4] * scale;
+	auto cx = cdata[2] * scale; auto cy = cdata[5] * scale;
+
+	return (Mat_<double>(3,3) << fx, 0, cx, 0, fy, cy, 0, 0, 1);
+}
+
+//--------------------------------------------------
+// Conversion
+//--------------------------------------------------
+
+/**
+ * @brief Convert a color image into a floating point intensity image
+ * @param color The color (or gray) image that we are converting
+ * @return Mat The resultant single channel float image
+ */
+Mat PyramidUtils::GetGrayImage(Mat& color)
+{
+	Mat gray; if (color.channels() == 3) cvtColor(color, gray, COLOR_BGR2GRAY); else gray = color;
+	Mat result; gray.convertTo(result, CV_32F);
+	return result;
+}
@@ -0,0 +1,27 @@
+//--------------------------------------------------
+// A set of utilities for building image and depth pyramids for dense odometry
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVLib
+{
+	class PyramidUtils
+	{
+	public:
+		static Mat DownsampleDepth(Mat& depth);
+		static Mat DownsampleImage(Mat& image);
+		static Mat ScaleCamera(Mat& camera, int level);
+		static Mat GetGrayImage(Mat& color);
+	};
+}
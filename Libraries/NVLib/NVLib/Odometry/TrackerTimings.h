@@ -0,0 +1,51 @@
+//--------------------------------------------------
+// Collects the time spent in each stage of a tracker
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <map>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVLib
+{
+	class TrackerTimings
+	{
+	private:
+		map<string, double> _totals;
+	public:
+		TrackerTimings() {}
+
+		/**
+		 * @brief Record the time elapsed since a given tick count against a stage
+		 * @param stage The name of the stage
+		 * @param startTicks The tick count (getTickCount) at the start of the stage
+		 */
+		inline void Record(const string& stage, int64 startTicks) 
+		{
+			_totals[stage] += (getTickCount() - startTicks) / getTickFrequency();
+		}
+
+		/**
+		 * @brief Retrieve the time spent in a given stage
+		 * @param stage The name of the stage
+		 * @return double The total time in seconds
+		 */
+		inline double Get(const string& stage) 
+		{
+			auto match = _totals.find(stage);
+			return match == _totals.end() ? 0 : match->second;
+		}
+
+		inline void Clear() { _totals.clear(); }
+		inline map<string, double>& GetTotals() { return _totals; }
+	};
+}
@@ -19,6 +19,9 @@ using namespace NVLib;
  */
 void PlyLoader::Load(const string& path, vector<ColorPoint *>& vertices, vector< vector<int> >& indices)
 {
+	static auto& latency = Metrics::GetHistogram("nvlib_ply_read_ns"); MetricTimer timer(latency);
+	static auto& vertexCounter = Metrics::GetCounter("nvlib_ply_vertices");
+
 	auto reader = ifstream(path);
 	if (!reader.is_open()) throw runtime_error("Unable to open: " + path);
 
@@ -29,7 +32,7 @@ void PlyLoader::Load(const string& path, vector<ColorPoint *>& vertices, vector<
 	FillVertices(reader, vertexCount, vertices);
 	FillIndices(reader, indexCount, indices);
 
-	reader.close();
+	reader.close(); vertexCounter.Add(vertexCount);
 }
 
 /**
@@ -64,8 +67,8 @@ int PlyLoader::GetVertexCount(const string& headerText)
 	{
 		if (StringUtils::StartsWith(line, "element vertex")) 
 		{
-			auto parts = vector<string>();
-			StringUtils::Split(line, ' ', parts);
+			auto parts = vector<string_view>();
+			StringUtils::SplitWhitespace(line, parts);
 			if (parts.size() != 3) throw runtime_error("element vertex clause does not appear valid");
 			return StringUtils::String2Int(parts[2]);
 		}
@@ -88,8 +91,8 @@ int PlyLoader::GetIndexCount(const string& headerText)
 	{
 		if (StringUtils::StartsWith(line, "element face"))
 		{
-			auto parts = vector<string>();
-			StringUtils::Split(line, ' ', parts);
+			auto parts = vector<string_view>();
+			StringUtils::SplitWhitespace(line, parts);
 			if (parts.size() != 3) throw runtime_error("element vertex clause does not appear valid");
 			return StringUtils::String2Int(parts[2]);
 		}
@@ -106,12 +109,12 @@ int PlyLoader::GetIndexCount(const string& headerText)
 */
 void PlyLoader::FillVertices(istream& reader, int vertexCount, vector<ColorPoint *>& vertices) 
 {
+	auto line = string(); auto parts = vector<string_view>();
+
 	for (auto i = 0; i < vertexCount; i++) 
 	{
-		auto line = string(); getline(reader, line);
-		auto tline = string(); StringUtils::Trim(line, tline);
-		auto parts = vector<string>();
-		StringUtils::Split(tline, ' ', parts);
+		getline(reader, line);
+		StringUtils::SplitWhitespace(line, parts);
 		if (parts.size() < 6) throw runtime_error("Invalid vertex line!");
 
 		auto x = StringUtils::String2Double(parts[0]);
@@ -134,12 +137,12 @@ void PlyLoader::FillVertices(istream& reader, int vertexCount, vector<ColorPoint
 */
 void PlyLoader::FillIndices(istream& reader, int indexCount, vector< vector<int> >& indices) 
 {
+	auto line = string(); auto parts = vector<string_view>();
+
 	for (auto i = 0; i < indexCount; i++)
 	{
-		auto line = string(); getline(reader, line);
-		auto tline = string();  StringUtils::Trim(line, tline);
-		auto parts = vector<string>();
-		StringUtils::Split(tline, ' ', parts);
+		getline(reader, line);
+		StringUtils::SplitWhitespace(line, parts);
 		if (parts.size() <= 1) throw runtime_error("Invalid index line!");
 
 		indices.push_back(vector<int>());
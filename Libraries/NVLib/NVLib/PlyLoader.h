@@ -14,6 +14,7 @@ using namespace std;
 #include "Model/ColorPoint.h"
 
 #include "StringUtils.h"
+#include "Metrics.h"
 
 namespace NVLib
 {
@@ -0,0 +1,231 @@
+//--------------------------------------------------
+// Implementation of class BlockSolver
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "BlockSolver.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Structure
+//--------------------------------------------------
+
+/**
+ * @brief Set the number of block rows (and columns) within the system
+ * @param blockCount The number of blocks
+ */
+void BlockSolver::Resize(int blockCount)
+{
+	_columns.resize(blockCount);
+}
+
+/**
+ * @brief Zero all the blocks
+ * @remark The block structure (including fill from earlier factorizations) is kept, so refactorizing the same graph does not allocate
+ */
+void BlockSolver::Reset()
+{
+	for (auto& column : _columns)
+	{
+		for (auto& block : column) block.second = Matx66d::zeros();
+	}
+}
+
+/**
+ * @brief Accumulate a block into the system
+ * @param row The block row
+ * @param column The block column
+ * @param block The block being added (only the lower triangle of the system is stored)
+ */
+void BlockSolver::AddBlock(int row, int column, const Matx66d& block)
+{
+	if (row < column) _columns[row][column] += block.t();
+	else _columns[column][row] += block;
+}
+
+//--------------------------------------------------
+// Factorization
+//--------------------------------------------------
+
+/**
+ * @brief Perform an in-place right-looking block Cholesky factorization (A = LLt)
+ * @return true The factorization succeeded
+ * @return false The system is not positive definite
+ */
+bool BlockSolver::Factorize()
+{
+	for (auto k = 0; k < (int)_columns.size(); k++)
+	{
+		auto& column = _columns[k];
+
+		// The rows are sorted, so the diagonal is always first
+		auto diagonal = column.find(k);
+		if (diagonal == column.end() || !Cholesky(diagonal->second)) return false;
+
+		auto& lower = diagonal->second;
+		for (auto entry = next(diagonal); entry != column.end(); entry++) entry->second = SolveRight(lower, entry->second);
+
+		// Update the trailing system (this is where fill gets created)
+		for (auto r = next(diagonal); r != column.end(); r++)
+		{
+			for (auto s = next(diagonal); s != next(r); s++)
+			{
+				_columns[s->first][r->first] -= r->second * s->second.t();
+			}
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief Solve the factorized system
+ * @param b The right hand side
+ * @param x The output solution
+ */
+void BlockSolver::Solve(const vector<Vec6d>& b, vector<Vec6d>& x)
+{
+	auto count = (int)_columns.size();
+	if ((int)b.size() != count) throw runtime_error("The right hand side does not match the system size");
+
+	// Forward substitution (Ly = b)
+	auto y = b;
+	for (auto k = 0; k < count; k++)
+	{
+		auto diagonal = _columns[k].begin();
+		y[k] = ForwardSolve(diagonal->second, y[k]);
+		for (auto entry = next(diagonal); entry != _columns[k].end(); entry++) y[entry->first] -= entry->second * y[k];
+	}
+
+	// Backward substitution (Ltx = y)
+	x = y;
+	for (auto k = count - 1; k >= 0; k--)
+	{
+		auto diagonal = _columns[k].begin();
+		for (auto entry = next(diagonal); entry != _columns[k].end(); entry++) x[k] -= entry->second.t() * x[entry->first];
+		x[k] = BackSolve(diagonal->second, x[k]);
+	}
+}
+
+//--------------------------------------------------
+// Statistics
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the number of block rows within the system
+ * @return int The block count
+ */
+int BlockSolver::GetBlockCount()
+{
+	return (int)_columns.size();
+}
+
+/**
+ * @brief Retrieve the number of stored blocks (lower triangle, including fill)
+ * @return int The number of stored blocks
+ */
+int BlockSolver::GetNonZeroBlocks()
+{
+	auto result = 0;
+	for (auto& column : _columns) result += (int)column.size();
+	return result;
+}
+
+//--------------------------------------------------
+// Dense Block Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Perform a dense Cholesky factorization of a single block (in place, lower triangle)
+ * @param block The block that we are factorizing
+ * @return true The block was positive definite
+ * @return false The block was not positive definite
+ */
+bool BlockSolver::Cholesky(Matx66d& block)
+{
+	for (auto j = 0; j < 6; j++)
+	{
+		auto sum = block(j, j);
+		for (auto k = 0; k < j; k++) sum -= block(j, k) * block(j, k);
+		if (sum <= 0) return false;
+
+		auto diagonal = sqrt(sum); block(j, j) = diagonal;
+
+		for (auto i = j + 1; i < 6; i++)
+		{
+			auto value = block(i, j);
+			for (auto k = 0; k < j; k++) value -= block(i, k) * block(j, k);
+			block(i, j) = value / diagonal;
+		}
+
+		for (auto i = 0; i < j; i++) block(i, j) = 0;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Find X such that X * Lt = B
+ * @param lower The lower triangular factor L
+ * @param block The block B
+ * @return Matx66d The resultant X
+ */
+Matx66d BlockSolver::SolveRight(const Matx66d& lower, const Matx66d& block)
+{
+	auto result = Matx66d();
+
+	for (auto row = 0; row < 6; row++)
+	{
+		for (auto j = 0; j < 6; j++)
+		{
+			auto value = block(row, j);
+			for (auto k = 0; k < j; k++) value -= result(row, k) * lower(j, k);
+			result(row, j) = value / lower(j, j);
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @brief Solve Ly = b for a single lower triangular block
+ * @param lower The lower triangular block
+ * @param b The right hand side
+ * @return Vec6d The solution
+ */
+Vec6d BlockSolver::ForwardSolve(const Matx66d& lower, const Vec6d& b)
+{
+	auto result = Vec6d();
+
+	for (auto i = 0; i < 6; i++)
+	{
+		auto value = b[i];
+		for (auto k = 0; k < i; k++) value -= lower(i, k) * result[k];
+		result[i] = value / lower(i, i);
+	}
+
+	return result;
+}
+
+/**
+ * @brief Solve Ltx = b for a single lower triangular block
+ * @param lower The lower triangular block
+ * @param b The right hand side
+ * @return Vec6d The solution
+ */
+Vec6d BlockSolver::BackSolve(const Matx66d& lower, const Vec6d& b)
+{
+	auto result = Vec6d();
+
+	for (auto i = 5; i >= 0; i--)
+	{
+		auto value = b[i];
+		for (auto k = i + 1; k < 6; k++) value -= lower(k, i) * result[k];
+		result[i] = value / lower(i, i);
+	}
+
+	return result;
+}
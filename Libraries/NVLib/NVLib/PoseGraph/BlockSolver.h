@@ -0,0 +1,44 @@
+//--------------------------------------------------
+// A sparse block Cholesky solver for symmetric systems made of 6x6 blocks
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <map>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVLib
+{
+	class BlockSolver
+	{
+	private:
+		vector<map<int, Matx66d>> _columns;
+	public:
+		BlockSolver() {}
+
+		void Resize(int blockCount);
+		void Reset();
+		void AddBlock(int row, int column, const Matx66d& block);
+
+		bool Factorize();
+		void Solve(const vector<Vec6d>& b, vector<Vec6d>& x);
+
+		int GetBlockCount();
+		int GetNonZeroBlocks();
+
+		inline vector<map<int, Matx66d>>& GetColumns() { return _columns; }
+	private:
+		static bool Cholesky(Matx66d& block);
+		static Matx66d SolveRight(const Matx66d& lower, const Matx66d& block);
+		static Vec6d ForwardSolve(const Matx66d& lower, const Vec6d& b);
+		static Vec6d BackSolve(const Matx66d& lower, const Vec6d& b);
+	};
+}
@@ -0,0 +1,46 @@
+//--------------------------------------------------
+// A relative pose constraint between two nodes of a pose graph
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVLib
+{
+	class PoseEdge
+	{
+	private:
+		int _from;
+		int _to;
+		Matx44d _measurement;
+		Matx66d _information;
+		bool _loop;
+	public:
+
+		/**
+		 * @brief Main Constructor
+		 * @param from The index of the node that the measurement is relative to
+		 * @param to The index of the node being measured
+		 * @param measurement The pose of the "to" node within the frame of the "from" node
+		 * @param information The information matrix (rotation first, then translation)
+		 * @param loop Indicates whether this edge came from a loop candidate
+		 */
+		PoseEdge(int from, int to, const Matx44d& measurement, const Matx66d& information, bool loop) :
+			_from(from), _to(to), _measurement(measurement), _information(information), _loop(loop) {}
+
+		inline int& GetFrom() { return _from; }
+		inline int& GetTo() { return _to; }
+		inline Matx44d& GetMeasurement() { return _measurement; }
+		inline Matx66d& GetInformation() { return _information; }
+		inline bool& GetLoop() { return _loop; }
+	};
+}
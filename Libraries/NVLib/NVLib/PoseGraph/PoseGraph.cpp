@@ -0,0 +1,377 @@
+//--------------------------------------------------
+// Implementation of class PoseGraph
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "PoseGraph.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Constructors
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ */
+PoseGraph::PoseGraph()
+{
+	_variableCount = 0; _structureChanged = true; _iterations = 0;
+}
+
+//--------------------------------------------------
+// Graph Construction
+//--------------------------------------------------
+
+/**
+ * @brief Add a node to the graph
+ * @param pose The initial estimate of the pose (camera to world)
+ * @param fixed Indicates whether the pose is held constant during optimisation
+ * @return int The index of the new node
+ */
+int PoseGraph::AddNode(Mat& pose, bool fixed)
+{
+	_poses.push_back(ToMatx(pose)); _fixed.push_back(fixed);
+	_structureChanged = true;
+	return (int)_poses.size() - 1;
+}
+
+/**
+ * @brief Add a new node chained onto the last node from a tracker pose
+ * @param trackerPose The tracker pose (maps points in the previous frame into the new frame)
+ * @param information The information matrix of the odometry edge
+ * @return int The index of the new node
+ * @remark The first node added this way becomes the origin
+ */
+int PoseGraph::AddOdometry(Mat& trackerPose, const Matx66d& information)
+{
+	if (_poses.empty())
+	{
+		Mat origin = Mat_<double>::eye(4,4);
+		AddNode(origin, true);
+	}
+
+	// The tracker pose maps previous into current, so the current camera within the previous frame is its inverse
+	auto last = (int)_poses.size() - 1;
+	auto measurement = Invert(ToMatx(trackerPose));
+
+	_poses.push_back(_poses[last] * measurement); _fixed.push_back(false);
+	_edges.push_back(PoseEdge(last, last + 1, measurement, information, false));
+	_structureChanged = true;
+
+	return last + 1;
+}
+
+/**
+ * @brief Add a relative pose constraint
+ * @param from The node that the measurement is relative to
+ * @param to The node that is being measured
+ * @param measurement The pose of the "to" camera within the "from" camera frame (inv(T_from) * T_to)
+ * @param information The information matrix (rotation first, then translation)
+ * @param loop Indicates whether this edge is a loop candidate
+ */
+void PoseGraph::AddEdge(int from, int to, Mat& measurement, const Matx66d& information, bool loop)
+{
+	auto count = (int)_poses.size();
+	if (from < 0 || to < 0 || from >= count || to >= count || from == to) throw runtime_error("Invalid pose graph edge");
+
+	_edges.push_back(PoseEdge(from, to, ToMatx(measurement), information, loop));
+	_structureChanged = true;
+}
+
+/**
+ * @brief Set whether a node is held constant
+ * @param index The index of the node
+ * @param fixed The fixed state
+ */
+void PoseGraph::SetFixed(int index, bool fixed)
+{
+	_fixed[index] = fixed; _structureChanged = true;
+}
+
+//--------------------------------------------------
+// Optimisation
+//--------------------------------------------------
+
+/**
+ * @brief Optimise the graph using Gauss-Newton with a sparse block Cholesky solver
+ * @param maxIterations The maximum number of iterations
+ * @param tolerance The update size below which we consider the graph converged
+ * @return double The final weighted squared error
+ * @remark The current poses are the starting point, so re-optimising after adding edges only has to correct the new error
+ */
+double PoseGraph::Optimise(int maxIterations, double tolerance)
+{
+	_iterations = 0;
+
+	if (_structureChanged) { UpdateVariables(); _structureChanged = false; }
+	if (_variableCount == 0) return GetError();
+
+	auto b = vector<Vec6d>(); auto x = vector<Vec6d>();
+
+	for (auto iteration = 0; iteration < maxIterations; iteration++)
+	{
+		BuildSystem(b);
+		if (!_solver.Factorize()) break;
+		_solver.Solve(b, x);
+
+		// Apply the update on the right of each free pose
+		auto updateSize = 0.0;
+		for (auto node = 0; node < (int)_poses.size(); node++)
+		{
+			auto variable = _variables[node]; if (variable < 0) continue;
+			auto update = -x[variable];
+			_poses[node] = _poses[node] * Exp(update);
+			updateSize = std::max(updateSize, norm(update));
+		}
+
+		_iterations++;
+		if (updateSize < tolerance) break;
+	}
+
+	return GetError();
+}
+
+/**
+ * @brief Calculate the weighted squared error of the graph
+ * @return double The total error
+ */
+double PoseGraph::GetError()
+{
+	auto result = 0.0;
+
+	for (auto& edge : _edges)
+	{
+		auto error = GetEdgeError(edge);
+		result += error.dot(edge.GetInformation() * error);
+	}
+
+	return result;
+}
+
+//--------------------------------------------------
+// Output
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the current estimate of a pose
+ * @param index The index of the node
+ * @return Mat The pose (camera to world)
+ */
+Mat PoseGraph::GetPose(int index)
+{
+	return Mat(_poses[index]).clone();
+}
+
+/**
+ * @brief Write the poses in the layout that CloudGen reads (pose_XXXX.xml with a "pose" key)
+ * @param folder The folder that we are writing to
+ */
+void PoseGraph::SavePoses(const string& folder)
+{
+	if (!FileUtils::Exists(folder)) FileUtils::AddFolders(folder);
+
+	for (auto index = 0; index < (int)_poses.size(); index++)
+	{
+		auto filename = stringstream(); filename << "pose_" << setw(4) << setfill('0') << index << ".xml";
+		auto path = FileUtils::PathCombine(folder, filename.str());
+
+		auto writer = FileStorage(path, FileStorage::FORMAT_XML | FileStorage::WRITE);
+		writer << "pose" << GetPose(index);
+		writer.release();
+	}
+}
+
+//--------------------------------------------------
+// Linear System
+//--------------------------------------------------
+
+/**
+ * @brief Assign a variable index to every free node
+ * @remark If no node is fixed, the first node is held to remove the gauge freedom
+ */
+void PoseGraph::UpdateVariables()
+{
+	auto anyFixed = false;
+	for (auto fixed : _fixed) anyFixed |= fixed;
+
+	auto variables = vector<int>(); _variableCount = 0;
+	for (auto node = 0; node < (int)_poses.size(); node++)
+	{
+		auto fixed = _fixed[node] || (!anyFixed && node == 0);
+		variables.push_back(fixed ? -1 : _variableCount++);
+	}
+
+	// Appending nodes keeps the existing ordering, so the block structure (and its fill) can be reused
+	auto reuse = variables.size() >= _variables.size() && equal(_variables.begin(), _variables.end(), variables.begin());
+	if (!reuse) _solver = BlockSolver();
+
+	_variables = variables; _solver.Resize(_variableCount);
+}
+
+/**
+ * @brief Linearise the edges and accumulate the normal equations
+ * @param b The output gradient (one 6-vector per variable)
+ * @return double The weighted squared error at the linearisation point
+ */
+double PoseGraph::BuildSystem(vector<Vec6d>& b)
+{
+	auto edgeCount = (int)_edges.size();
+	auto errors = vector<Vec6d>(edgeCount); auto jacobians = vector<Matx66d>(edgeCount);
+
+	// Linearising is independent per edge, so it is done in parallel
+	parallel_for_(Range(0, edgeCount), [&](const Range& range)
+	{
+		for (auto i = range.start; i < range.end; i++)
+		{
+			auto& edge = _edges[i];
+			errors[i] = GetEdgeError(edge);
+
+			// The jacobian wrt the "to" pose is identity, the "from" pose is the negative adjoint of the relative pose
+			jacobians[i] = -Adjoint(Invert(_poses[edge.GetTo()]) * _poses[edge.GetFrom()]);
+		}
+	});
+
+	_solver.Reset(); b.assign(_variableCount, Vec6d());
+	auto result = 0.0;
+
+	for (auto i = 0; i < edgeCount; i++)
+	{
+		auto& edge = _edges[i]; auto& omega = edge.GetInformation(); auto& J = jacobians[i];
+		auto from = _variables[edge.GetFrom()]; auto to = _variables[edge.GetTo()];
+
+		Vec6d weighted = omega * errors[i];
+		result += errors[i].dot(weighted);
+
+		if (from >= 0)
+		{
+			Matx66d JtOmega = J.t() * omega;
+			_solver.AddBlock(from, from, JtOmega * J);
+			b[from] += JtOmega * errors[i];
+			if (to >= 0) _solver.AddBlock(to, from, JtOmega.t());
+		}
+
+		if (to >= 0)
+		{
+			_solver.AddBlock(to, to, omega);
+			b[to] += weighted;
+		}
+	}
+
+	// Nodes that have no edges still need a diagonal to keep the system solvable
+	for (auto variable = 0; variable < _variableCount; variable++) _solver.AddBlock(variable, variable, Matx66d::eye() * 1e-9);
+
+	return result;
+}
+
+/**
+ * @brief Calculate the error of an edge
+ * @param edge The edge that we are evaluating
+ * @return Vec6d The error (rotation vector, translation) of inv(Z) * inv(T_from) * T_to
+ */
+Vec6d PoseGraph::GetEdgeError(PoseEdge& edge)
+{
+	Matx44d relative = Invert(_poses[edge.GetFrom()]) * _poses[edge.GetTo()];
+	return Log(Invert(edge.GetMeasurement()) * relative);
+}
+
+//--------------------------------------------------
+// SE3 Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Invert a rigid transform
+ * @param pose The pose that we are inverting
+ * @return Matx44d The inverse
+ */
+Matx44d PoseGraph::Invert(const Matx44d& pose)
+{
+	auto result = Matx44d::eye();
+
+	for (auto row = 0; row < 3; row++)
+	{
+		for (auto column = 0; column < 3; column++) result(row, column) = pose(column, row);
+		result(row, 3) = -(pose(0, row) * pose(0, 3) + pose(1, row) * pose(1, 3) + pose(2, row) * pose(2, 3));
+	}
+
+	return result;
+}
+
+/**
+ * @brief Convert an update vector into a transform
+ * @param update The update (rotation vector, translation)
+ * @return Matx44d The resultant transform
+ */
+Matx44d PoseGraph::Exp(const Vec6d& update)
+{
+	auto rotation = Matx33d(); Rodrigues(Vec3d(update[0], update[1], update[2]), rotation);
+
+	auto result = Matx44d::eye();
+	for (auto row = 0; row < 3; row++)
+	{
+		for (auto column = 0; column < 3; column++) result(row, column) = rotation(row, column);
+		result(row, 3) = update[3 + row];
+	}
+
+	return result;
+}
+
+/**
+ * @brief Convert a transform into a 6-vector
+ * @param pose The transform that we are converting
+ * @return Vec6d The vector (rotation vector, translation)
+ */
+Vec6d PoseGraph::Log(const Matx44d& pose)
+{
+	auto rotation = Matx33d();
+	for (auto row = 0; row < 3; row++) for (auto column = 0; column < 3; column++) rotation(row, column) = pose(row, column);
+
+	auto rvec = Vec3d(); Rodrigues(rotation, rvec);
+
+	return Vec6d(rvec[0], rvec[1], rvec[2], pose(0, 3), pose(1, 3), pose(2, 3));
+}
+
+/**
+ * @brief Calculate the adjoint of a transform
+ * @param pose The transform
+ * @return Matx66d The adjoint (maps a (rotation, translation) twist through the transform)
+ */
+Matx66d PoseGraph::Adjoint(const Matx44d& pose)
+{
+	auto result = Matx66d::zeros();
+	auto tx = pose(0, 3); auto ty = pose(1, 3); auto tz = pose(2, 3);
+
+	for (auto row = 0; row < 3; row++)
+	{
+		for (auto column = 0; column < 3; column++)
+		{
+			result(row, column) = pose(row, column);
+			result(row + 3, column + 3) = pose(row, column);
+		}
+	}
+
+	// The lower left block is skew(t) * R
+	for (auto column = 0; column < 3; column++)
+	{
+		auto r0 = pose(0, column); auto r1 = pose(1, column); auto r2 = pose(2, column);
+		result(3, column) = ty * r2 - tz * r1;
+		result(4, column) = tz * r0 - tx * r2;
+		result(5, column) = tx * r1 - ty * r0;
+	}
+
+	return result;
+}
+
+/**
+ * @brief Convert a pose into its fixed size form
+ * @param pose The pose (4x4)
+ * @return Matx44d The fixed size pose
+ */
+Matx44d PoseGraph::ToMatx(Mat& pose)
+{
+	if (pose.rows != 4 || pose.cols != 4) throw runtime_error("Poses are expected to be 4x4 matrices");
+	Mat converted; pose.convertTo(converted, CV_64F);
+	return Matx44d((double *) converted.data);
+}
@@ -0,0 +1,65 @@
+//--------------------------------------------------
+// A pose graph (SE3 nodes, relative pose edges) with a sparse Gauss-Newton optimiser
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "../FileUtils.h"
+
+#include "PoseEdge.h"
+#include "BlockSolver.h"
+
+namespace NVLib
+{
+	class PoseGraph
+	{
+	private:
+		vector<Matx44d> _poses;
+		vector<bool> _fixed;
+		vector<PoseEdge> _edges;
+		vector<int> _variables;
+		BlockSolver _solver;
+		int _variableCount;
+		bool _structureChanged;
+		int _iterations;
+	public:
+		PoseGraph();
+
+		int AddNode(Mat& pose, bool fixed = false);
+		int AddOdometry(Mat& trackerPose, const Matx66d& information = Matx66d::eye());
+		void AddEdge(int from, int to, Mat& measurement, const Matx66d& information = Matx66d::eye(), bool loop = false);
+		void SetFixed(int index, bool fixed);
+
+		double Optimise(int maxIterations = 10, double tolerance = 1e-6);
+		double GetError();
+
+		Mat GetPose(int index);
+		void SavePoses(const string& folder);
+
+		inline int GetNodeCount() { return (int)_poses.size(); }
+		inline vector<PoseEdge>& GetEdges() { return _edges; }
+		inline BlockSolver& GetSolver() { return _solver; }
+		inline int GetIterations() { return _iterations; }
+	private:
+		void UpdateVariables();
+		double BuildSystem(vector<Vec6d>& b);
+		Vec6d GetEdgeError(PoseEdge& edge);
+
+		static Matx44d Invert(const Matx44d& pose);
+		static Matx44d Exp(const Vec6d& update);
+		static Vec6d Log(const Matx44d& pose);
+		static Matx66d Adjoint(const Matx44d& pose);
+		static Matx44d ToMatx(Mat& pose);
+	};
+}
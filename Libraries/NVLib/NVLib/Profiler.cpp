@@ -0,0 +1,172 @@
+//--------------------------------------------------
+// Implementation of class Profiler
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "Profiler.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Static State
+//--------------------------------------------------
+
+atomic<bool> Profiler::_enabled(false);
+mutex Profiler::_lock;
+vector<shared_ptr<ProfileBuffer>> Profiler::_buffers;
+
+//--------------------------------------------------
+// Recording
+//--------------------------------------------------
+
+/**
+ * @brief Turn the recording of scopes on or off
+ * @param value The new setting
+ */
+void Profiler::SetEnabled(bool value)
+{
+	_enabled.store(value);
+}
+
+/**
+ * @brief Retrieve the current time from a monotonic clock
+ * @return int64_t The time in nanoseconds
+ */
+int64_t Profiler::GetTime()
+{
+	return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Retrieve the event buffer of the calling thread
+ * @return ProfileBuffer * The buffer (created and registered on first use)
+ * @remark Buffers are kept alive by the profiler, so events from threads that have finished are still exported
+ */
+ProfileBuffer * Profiler::GetBuffer()
+{
+	thread_local shared_ptr<ProfileBuffer> buffer;
+
+	if (buffer == nullptr)
+	{
+		buffer = make_shared<ProfileBuffer>();
+
+		lock_guard<mutex> lock(_lock);
+		buffer->threadId = (int)_buffers.size(); _buffers.push_back(buffer);
+	}
+
+	return buffer.get();
+}
+
+/**
+ * @brief Remove all the recorded events
+ * @remark This should only be called while no scopes are open
+ */
+void Profiler::Clear()
+{
+	lock_guard<mutex> lock(_lock);
+	for (auto& buffer : _buffers) buffer->events.clear();
+}
+
+//--------------------------------------------------
+// Summary
+//--------------------------------------------------
+
+/**
+ * @brief Aggregate the recorded events by scope name
+ * @param output The statistics for each name (sorted by total time)
+ * @remark This should be called once the profiled work has finished
+ */
+void Profiler::GetSummary(vector<ProfileStats>& output)
+{
+	lock_guard<mutex> lock(_lock);
+
+	auto durations = unordered_map<string, vector<int64_t>>(); auto selfTimes = unordered_map<string, int64_t>();
+
+	for (auto& buffer : _buffers) 
+	{
+		for (auto& event : buffer->events) 
+		{
+			durations[event.name].push_back(event.duration);
+			selfTimes[event.name] += event.self;
+		}
+	}
+
+	output.clear();
+	for (auto& entry : durations) 
+	{
+		auto& values = entry.second; auto total = int64_t(0);
+		for (auto value : values) total += value;
+
+		auto percentile = [&values](double fraction) 
+		{
+			auto index = (size_t)(fraction * (values.size() - 1) + 0.5);
+			nth_element(values.begin(), values.begin() + index, values.end());
+			return values[index] * 1e-6;
+		};
+
+		auto p50 = percentile(0.5); auto p99 = percentile(0.99);
+		output.push_back({ entry.first, (int)values.size(), total * 1e-6, selfTimes[entry.first] * 1e-6, p50, p99 });
+	}
+
+	sort(output.begin(), output.end(), [](const ProfileStats& first, const ProfileStats& second) { return first.total > second.total; });
+}
+
+//--------------------------------------------------
+// Export
+//--------------------------------------------------
+
+/**
+ * @brief Save the recorded events in the Chrome trace format (viewable in chrome://tracing or Perfetto)
+ * @param path The path that we are saving to
+ */
+void Profiler::SaveTrace(const string& path)
+{
+	auto writer = ofstream(path);
+	if (!writer.is_open()) throw runtime_error("Unable to open location: " + path);
+
+	lock_guard<mutex> lock(_lock);
+
+	// Timestamps are written relative to the first event
+	auto origin = INT64_MAX;
+	for (auto& buffer : _buffers) for (auto& event : buffer->events) origin = std::min(origin, event.start);
+
+	writer << "{\"traceEvents\":[" << endl; auto first = true;
+	writer << fixed << setprecision(3);
+
+	for (auto& buffer : _buffers) 
+	{
+		for (auto& event : buffer->events) 
+		{
+			writer << (first ? "" : ",\n") << "{\"name\":\"" << EscapeUtils::JsonEscape(event.name) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId;
+			writer << ",\"ts\":" << (event.start - origin) * 1e-3 << ",\"dur\":" << event.duration * 1e-3 << "}";
+			first = false;
+		}
+	}
+
+	writer << endl << "],\"displayTimeUnit\":\"ms\"}" << endl;
+	writer.close();
+}
+
+/**
+ * @brief Save the aggregate statistics as a CSV table (times in milliseconds)
+ * @param path The path that we are saving to
+ */
+void Profiler::SaveSummary(const string& path)
+{
+	auto stats = vector<ProfileStats>(); GetSummary(stats);
+
+	auto writer = ofstream(path);
+	if (!writer.is_open()) throw runtime_error("Unable to open location: " + path);
+
+	writer << "name,calls,total,self,p50,p99" << endl;
+	writer << fixed << setprecision(6);
+
+	for (auto& entry : stats) 
+	{
+		writer << entry.name << "," << entry.calls << "," << entry.total << "," << entry.self << "," << entry.p50 << "," << entry.p99 << endl;
+	}
+
+	writer.close();
+}
@@ -0,0 +1,121 @@
+//--------------------------------------------------
+// A scoped, per-thread profiler with Chrome trace and summary export
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <chrono>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <iomanip>
+#include <fstream>
+#include <iostream>
+using namespace std;
+
+#include "EscapeUtils.h"
+
+namespace NVLib
+{
+	/* A single completed scope (times in nanoseconds) */
+	struct ProfileEvent
+	{
+		const char * name;
+		int64_t start;
+		int64_t duration;
+		int64_t self;
+		int depth;
+	};
+
+	/* The aggregate timing of all the scopes with a given name (times in milliseconds) */
+	struct ProfileStats
+	{
+		string name;
+		int calls;
+		double total;
+		double self;
+		double p50;
+		double p99;
+	};
+
+	/* The events recorded by a single thread */
+	struct ProfileBuffer
+	{
+		int threadId;
+		vector<ProfileEvent> events;
+		vector<int64_t> childTimes;
+	};
+
+	class Profiler
+	{
+	private:
+		static atomic<bool> _enabled;
+		static mutex _lock;
+		static vector<shared_ptr<ProfileBuffer>> _buffers;
+	public:
+		static void SetEnabled(bool value);
+		inline static bool IsEnabled() { return _enabled.load(memory_order_relaxed); }
+
+		static int64_t GetTime();
+		static ProfileBuffer * GetBuffer();
+
+		static void Clear();
+		static void GetSummary(vector<ProfileStats>& output);
+		static void SaveTrace(const string& path);
+		static void SaveSummary(const string& path);
+	};
+
+	class ProfileScope
+	{
+	private:
+		const char * _name;
+		int64_t _start;
+		ProfileBuffer * _buffer;
+	public:
+
+		/**
+		 * @brief Start timing a scope (this does nothing if the profiler is disabled)
+		 * @param name The name of the scope (this must be a string literal, or otherwise outlive the profiler)
+		 */
+		ProfileScope(const char * name) : _name(name), _start(0), _buffer(nullptr)
+		{
+			if (!Profiler::IsEnabled()) return;
+
+			_buffer = Profiler::GetBuffer(); _buffer->childTimes.push_back(0);
+			_start = Profiler::GetTime();
+		}
+
+		/**
+		 * @brief Stop timing the scope and record it within the thread's buffer
+		 */
+		~ProfileScope()
+		{
+			if (_buffer == nullptr) return;
+
+			auto duration = Profiler::GetTime() - _start;
+			auto children = _buffer->childTimes.back(); _buffer->childTimes.pop_back();
+			if (!_buffer->childTimes.empty()) _buffer->childTimes.back() += duration;
+
+			_buffer->events.push_back({ _name, _start, duration, duration - children, (int)_buffer->childTimes.size() });
+		}
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+	};
+}
+
+/* Scopes are only compiled in when NVLIB_PROFILING is defined, and then only record when the profiler is enabled */
+#ifdef NVLIB_PROFILING
+#define NVLIB_PROFILE_JOIN_(first, second) first##second
+#define NVLIB_PROFILE_JOIN(first, second) NVLIB_PROFILE_JOIN_(first, second)
+#define NVLIB_PROFILE_SCOPE(name) NVLib::ProfileScope NVLIB_PROFILE_JOIN(_profileScope, __LINE__)(name)
+#else
+#define NVLIB_PROFILE_SCOPE(name) ((void)0)
+#endif
@@ -24,8 +24,8 @@ cv::Mat RandomUtils::GetKMatrix(const Range<double> & focal, const cv::Size & im
 	auto fx = GetValue(focal);
 	auto fy = (sameFocal) ? fx : GetValue(focal);
 	auto cx = (imageSize.width * 0.5) + GetValue(centerOffset);
-	auto cy = (imageSize.width * 0.5) + GetValue(centerOffset);
-	return (cv::Mat_<double>(3,3) << fx, cx, 0, 0, fy, cy, 0, 0, 1);
+	auto cy = (imageSize.height * 0.5) + GetValue(centerOffset);
+	return (cv::Mat_<double>(3,3) << fx, 0, cx, 0, fy, cy, 0, 0, 1);
 }
 
 //--------------------------------------------------
@@ -94,10 +94,8 @@ cv::Mat RandomUtils::GetDistortionMatrix(const Range<double> & k1, const Range<d
 double RandomUtils::GetValue(const Range<double>& range)
 {
 	if (range.GetMax() == range.GetMin()) return range.GetMax();
-	random_device device;
-	auto generator = default_random_engine(device());
 	auto distribution = uniform_real_distribution<double>(range.GetMin(), range.GetMax());
-	return distribution(generator);
+	return distribution(GetEngine());
 }
 
 //--------------------------------------------------
@@ -175,4 +173,41 @@ int RandomUtils::GetInteger(int min, int max)
 {
 	auto width = max - min;
 	return (rand() % width) + min;
-}
\ No newline at end of file
+}
+
+//--------------------------------------------------
+// Seeding
+//--------------------------------------------------
+
+/**
+ * @brief Seed the random number generators so that a sequence of calls can be repeated
+ * @param seed The seed that we are using
+ * @remark Each thread's generator is reseeded from seed + a thread index (the seeding thread is index 0,
+ * the other threads are numbered in the order that they first draw a value after the call)
+ */
+void RandomUtils::Seed(unsigned int seed) 
+{
+	srand(seed);
+
+	_seed = seed; _threadCount = 0; _generation++;
+	GetEngine();
+}
+
+/**
+ * @brief Retrieve the calling thread's generator used for real valued random numbers
+ * @return default_random_engine& The generator (seeded from the random device until Seed is called)
+ */
+default_random_engine& RandomUtils::GetEngine() 
+{
+	thread_local auto engine = default_random_engine(random_device()());
+	thread_local auto generation = 0;
+
+	auto current = _generation.load();
+	if (generation != current) 
+	{
+		engine.seed(_seed.load() + (unsigned int)_threadCount++);
+		generation = current;
+	}
+
+	return engine;
+}
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <random>
+#include <atomic>
 #include <iostream>
 #include <cstdlib>
 #include <ctime>
@@ -22,6 +23,10 @@ namespace NVLib
 {
 	class RandomUtils
 	{
+	private:
+		inline static atomic<unsigned int> _seed{0};
+		inline static atomic<int> _generation{0};
+		inline static atomic<int> _threadCount{0};
 	public:
 		static cv::Mat GetKMatrix(const Range<double> & focal, const cv::Size & imageSize, const Range<double>& centerOffset, bool sameFocal);
 		static cv::Mat GetPoseMatrix(const Range<double>&  rx, const Range<double>& ry, const Range<double>& rz, const Range<double>& tx, const Range<double> ty, const Range<double>& tz);
@@ -32,5 +37,8 @@ namespace NVLib
 		static bool GetBinaryChoice(double probTrue);
 		static int GetInteger(const NVLib::Range<int>& range);
 		static int GetInteger(int min, int max);
+		static void Seed(unsigned int seed);
+	private:
+		static default_random_engine& GetEngine();
 	};
 }
@@ -199,4 +199,63 @@ void RectangleUtils::OrderPoints(vector<Point>& input, vector<Point>& output)
 	output.push_back(p2);
 	output.push_back(p3);
 	output.push_back(p4);
-}
\ No newline at end of file
+}
+
+//--------------------------------------------------
+// Region Coverage
+//--------------------------------------------------
+
+/**
+ * @brief Find the fraction of a region that is covered by a mask
+ * @param maskStats The region statistics of the mask
+ * @param region The region that we are checking (clipped to the mask)
+ * @return double The fraction of the pixels within the region that are set
+ */
+double RectangleUtils::GetCoverage(RegionStats& maskStats, const Rect& region)
+{
+	auto area = maskStats.GetArea(region); if (area == 0) return 0;
+	return (double)maskStats.GetCount(region) / area;
+}
+
+/**
+ * @brief Find the fraction of the bounding box of a set of corners that is covered by a mask
+ * @param maskStats The region statistics of the mask
+ * @param corners The corners of the (projective) rectangle
+ * @return double The fraction of the pixels within the bounding box that are set
+ */
+double RectangleUtils::GetCoverage(RegionStats& maskStats, const vector<Point>& corners)
+{
+	if (corners.size() == 0) throw runtime_error("At least one corner is needed to find the coverage");
+	return GetCoverage(maskStats, boundingRect(corners));
+}
+
+/**
+ * @brief Find the window that contains the most set mask pixels
+ * @param maskStats The region statistics of the mask
+ * @param windowSize The size of the window that we are sliding
+ * @param step The step size (in pixels) between the windows that are evaluated
+ * @return Rect The best window (the first one found if there is a tie)
+ * @remark Each window is a constant time lookup, so a dense search is cheap
+ */
+Rect RectangleUtils::FindDensestWindow(RegionStats& maskStats, const Size& windowSize, int step)
+{
+	auto& size = maskStats.GetSize();
+
+	if (step <= 0) throw runtime_error("The window step must be positive");
+	if (windowSize.width <= 0 || windowSize.height <= 0) throw runtime_error("Invalid window dimensions");
+	if (windowSize.width > size.width || windowSize.height > size.height) throw runtime_error("The window is bigger than the mask");
+
+	auto best = Rect(Point(0, 0), windowSize); auto bestCount = -1;
+
+	for (auto row = 0; row <= size.height - windowSize.height; row += step)
+	{
+		for (auto column = 0; column <= size.width - windowSize.width; column += step)
+		{
+			auto window = Rect(Point(column, row), windowSize);
+			auto count = maskStats.GetCount(window);
+			if (count > bestCount) { bestCount = count; best = window; }
+		}
+	}
+
+	return best;
+}
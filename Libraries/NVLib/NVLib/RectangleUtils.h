@@ -13,6 +13,7 @@ using namespace std;
 using namespace cv;
 
 #include "DisplayUtils.h"
+#include "RegionStats.h"
 
 namespace NVLib
 {
@@ -23,5 +24,8 @@ namespace NVLib
 		static void GetMaskCorners(Mat& mask, vector<Point>& outCorners);
 		static bool ApproxPoly(std::vector<cv::Point> contours, std::vector<cv::Point>& rects, double minepsilon, double maxepsilon, int sides);
 		static void OrderPoints(vector<Point>& input, vector<Point>& output);
+		static double GetCoverage(RegionStats& maskStats, const Rect& region);
+		static double GetCoverage(RegionStats& maskStats, const vector<Point>& corners);
+		static Rect FindDensestWindow(RegionStats& maskStats, const Size& windowSize, int step = 1);
 	};
 }
@@ -0,0 +1,75 @@
+//--------------------------------------------------
+// A refiner problem that derives its jacobian using dual numbers
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "Dual.h"
+#include "JacobianProblem.h"
+
+namespace NVLib
+{
+	/**
+	 * @brief The derived class implements "template <typename T> T Evaluate(const T * params, int problemId)" once
+	 * @tparam Derived The problem implementation
+	 * @tparam N The number of parameters
+	 */
+	template <typename Derived, int N>
+	class AutoDiffProblem : public JacobianProblem
+	{
+	public:
+
+		/**
+		 * @brief Calculate the error of a training item
+		 * @param params The current parameters
+		 * @param problemId The training item that we are evaluating
+		 * @return double The error
+		 */
+		double GetError(Mat& params, int problemId) override
+		{
+			Validate(params);
+			return static_cast<Derived *>(this)->Evaluate((const double *) params.data, problemId);
+		}
+
+		/**
+		 * @brief Calculate the error of a training item with its exact derivatives
+		 * @param params The current parameters
+		 * @param problemId The training item that we are evaluating
+		 * @param jacobian The output jacobian row
+		 * @return double The error
+		 */
+		double GetErrorAndJacobian(Mat& params, int problemId, double * jacobian) override
+		{
+			Validate(params);
+
+			auto pdata = (double *) params.data; Dual<N> variables[N];
+			for (auto i = 0; i < N; i++) variables[i] = Dual<N>::Variable(pdata[i], i);
+
+			auto result = static_cast<Derived *>(this)->Evaluate((const Dual<N> *) variables, problemId);
+			for (auto i = 0; i < N; i++) jacobian[i] = result.gradient[i];
+
+			return result.value;
+		}
+
+	private:
+
+		/**
+		 * @brief Check that the parameters match the problem size
+		 * @param params The parameters being checked
+		 */
+		inline void Validate(Mat& params)
+		{
+			if (params.type() != CV_64FC1 || params.rows * params.cols != N) throw runtime_error("Parameters do not match the auto-diff problem size");
+		}
+	};
+}
@@ -0,0 +1,48 @@
+//--------------------------------------------------
+// A refiner problem with a few global parameters and many small local parameter blocks
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "RefinerProblem.h"
+
+namespace NVLib
+{
+	/**
+	 * @brief The parameters are laid out as [global, block 0, block 1, ...] and each error depends on the global parameters and one block
+	 */
+	class BlockProblem : public RefinerProblem
+	{
+	public:
+		virtual int GetGlobalSize() = 0;
+		virtual int GetLocalSize() = 0;
+		virtual int GetBlockCount() = 0;
+
+		/**
+		 * @brief Retrieve the local block that a training item depends on
+		 * @param problemId The training item
+		 * @return int The index of the local block
+		 */
+		virtual int GetLocalBlock(int problemId) = 0;
+
+		/**
+		 * @brief Calculate the error of a training item along with its derivatives
+		 * @param params The current parameters (these are not modified)
+		 * @param problemId The training item that we are evaluating
+		 * @param globalJacobian The output derivatives wrt the global parameters
+		 * @param localJacobian The output derivatives wrt the parameters of the item's local block
+		 * @return double The error of the training item
+		 */
+		virtual double GetErrorAndJacobian(Mat& params, int problemId, double * globalJacobian, double * localJacobian) = 0;
+	};
+}
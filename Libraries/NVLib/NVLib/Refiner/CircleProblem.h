@@ -0,0 +1,60 @@
+//--------------------------------------------------
+// Fits a circle to a set of 2D points (an example of an auto-differentiated refiner problem)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "AutoDiffProblem.h"
+
+namespace NVLib
+{
+	/**
+	 * @brief The parameters are (center x, center y, radius) and each training item is one point
+	 */
+	class CircleProblem : public AutoDiffProblem<CircleProblem, 3>
+	{
+	private:
+		Mat _points;
+	public:
+
+		/**
+		 * @brief Main Constructor
+		 * @param points The points being fitted (CV_64FC1, one point per row)
+		 */
+		CircleProblem(Mat& points) : _points(points)
+		{
+			if (points.type() != CV_64FC1 || points.cols != 2) throw runtime_error("Circle points need to be a N x 2 double matrix");
+		}
+
+		/**
+		 * @brief The distance of a point from the circle (the same code is used for values and derivatives)
+		 * @param params The current parameters
+		 * @param problemId The point that we are evaluating
+		 * @return T The signed distance from the circle
+		 */
+		template <typename T> T Evaluate(const T * params, int problemId)
+		{
+			auto point = _points.ptr<double>(problemId);
+			auto dx = point[0] - params[0]; auto dy = point[1] - params[1];
+
+			// A point on the center has no direction, so only the radius contributes
+			auto distance2 = dx * dx + dy * dy;
+			if (distance2 <= 0.0) return -params[2];
+
+			return sqrt(distance2) - params[2];
+		}
+
+		inline int GetTrainingSize() override { return _points.rows; }
+		inline bool IsReentrant() override { return true; }
+	};
+}
@@ -0,0 +1,160 @@
+//--------------------------------------------------
+// A forward-mode dual number for calculating exact derivatives
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <iostream>
+using namespace std;
+
+namespace NVLib
+{
+	template <int N>
+	class Dual
+	{
+	public:
+		double value;
+		double gradient[N];
+
+		Dual() : value(0) { for (auto i = 0; i < N; i++) gradient[i] = 0; }
+		Dual(double constant) : value(constant) { for (auto i = 0; i < N; i++) gradient[i] = 0; }
+
+		/**
+		 * @brief Create a dual number that represents one of the variables being differentiated
+		 * @param variable The value of the variable
+		 * @param index The index of the variable
+		 * @return Dual The resultant dual number
+		 */
+		inline static Dual Variable(double variable, int index)
+		{
+			auto result = Dual(variable); result.gradient[index] = 1;
+			return result;
+		}
+
+		inline Dual& operator+=(const Dual& other) { *this = *this + other; return *this; }
+		inline Dual& operator-=(const Dual& other) { *this = *this - other; return *this; }
+		inline Dual& operator*=(const Dual& other) { *this = *this * other; return *this; }
+		inline Dual& operator/=(const Dual& other) { *this = *this / other; return *this; }
+	};
+
+	//--------------------------------------------------
+	// Helpers
+	//--------------------------------------------------
+
+	/**
+	 * @brief Apply the chain rule for a unary function
+	 * @param input The input to the function
+	 * @param value The value of the function
+	 * @param derivative The derivative of the function at the input
+	 * @return Dual<N> The resultant dual number
+	 */
+	template <int N> inline Dual<N> Chain(const Dual<N>& input, double value, double derivative)
+	{
+		auto result = Dual<N>(value);
+		for (auto i = 0; i < N; i++) result.gradient[i] = derivative * input.gradient[i];
+		return result;
+	}
+
+	/**
+	 * @brief Retrieve the value of a number (so that templated code works with plain doubles)
+	 */
+	inline double GetValue(double input) { return input; }
+	template <int N> inline double GetValue(const Dual<N>& input) { return input.value; }
+
+	//--------------------------------------------------
+	// Arithmetic
+	//--------------------------------------------------
+
+	template <int N> inline Dual<N> operator+(const Dual<N>& a, const Dual<N>& b)
+	{
+		auto result = Dual<N>(a.value + b.value);
+		for (auto i = 0; i < N; i++) result.gradient[i] = a.gradient[i] + b.gradient[i];
+		return result;
+	}
+
+	template <int N> inline Dual<N> operator-(const Dual<N>& a, const Dual<N>& b)
+	{
+		auto result = Dual<N>(a.value - b.value);
+		for (auto i = 0; i < N; i++) result.gradient[i] = a.gradient[i] - b.gradient[i];
+		return result;
+	}
+
+	template <int N> inline Dual<N> operator*(const Dual<N>& a, const Dual<N>& b)
+	{
+		auto result = Dual<N>(a.value * b.value);
+		for (auto i = 0; i < N; i++) result.gradient[i] = a.gradient[i] * b.value + a.value * b.gradient[i];
+		return result;
+	}
+
+	template <int N> inline Dual<N> operator/(const Dual<N>& a, const Dual<N>& b)
+	{
+		auto result = Dual<N>(a.value / b.value); auto scale = 1.0 / (b.value * b.value);
+		for (auto i = 0; i < N; i++) result.gradient[i] = (a.gradient[i] * b.value - a.value * b.gradient[i]) * scale;
+		return result;
+	}
+
+	template <int N> inline Dual<N> operator-(const Dual<N>& a) { return Chain(a, -a.value, -1.0); }
+
+	template <int N> inline Dual<N> operator+(const Dual<N>& a, double b) { return a + Dual<N>(b); }
+	template <int N> inline Dual<N> operator+(double a, const Dual<N>& b) { return Dual<N>(a) + b; }
+	template <int N> inline Dual<N> operator-(const Dual<N>& a, double b) { return a - Dual<N>(b); }
+	template <int N> inline Dual<N> operator-(double a, const Dual<N>& b) { return Dual<N>(a) - b; }
+	template <int N> inline Dual<N> operator*(const Dual<N>& a, double b) { return Chain(a, a.value * b, b); }
+	template <int N> inline Dual<N> operator*(double a, const Dual<N>& b) { return Chain(b, a * b.value, a); }
+	template <int N> inline Dual<N> operator/(const Dual<N>& a, double b) { return Chain(a, a.value / b, 1.0 / b); }
+	template <int N> inline Dual<N> operator/(double a, const Dual<N>& b) { return Dual<N>(a) / b; }
+
+	//--------------------------------------------------
+	// Comparison (on the value only)
+	//--------------------------------------------------
+
+	template <int N> inline bool operator<(const Dual<N>& a, const Dual<N>& b) { return a.value < b.value; }
+	template <int N> inline bool operator>(const Dual<N>& a, const Dual<N>& b) { return a.value > b.value; }
+	template <int N> inline bool operator<=(const Dual<N>& a, const Dual<N>& b) { return a.value <= b.value; }
+	template <int N> inline bool operator>=(const Dual<N>& a, const Dual<N>& b) { return a.value >= b.value; }
+	template <int N> inline bool operator==(const Dual<N>& a, const Dual<N>& b) { return a.value == b.value; }
+	template <int N> inline bool operator!=(const Dual<N>& a, const Dual<N>& b) { return a.value != b.value; }
+
+	template <int N> inline bool operator<(const Dual<N>& a, double b) { return a.value < b; }
+	template <int N> inline bool operator>(const Dual<N>& a, double b) { return a.value > b; }
+	template <int N> inline bool operator<=(const Dual<N>& a, double b) { return a.value <= b; }
+	template <int N> inline bool operator>=(const Dual<N>& a, double b) { return a.value >= b; }
+	template <int N> inline bool operator==(const Dual<N>& a, double b) { return a.value == b; }
+	template <int N> inline bool operator!=(const Dual<N>& a, double b) { return a.value != b; }
+
+	template <int N> inline bool operator<(double a, const Dual<N>& b) { return a < b.value; }
+	template <int N> inline bool operator>(double a, const Dual<N>& b) { return a > b.value; }
+	template <int N> inline bool operator<=(double a, const Dual<N>& b) { return a <= b.value; }
+	template <int N> inline bool operator>=(double a, const Dual<N>& b) { return a >= b.value; }
+	template <int N> inline bool operator==(double a, const Dual<N>& b) { return a == b.value; }
+	template <int N> inline bool operator!=(double a, const Dual<N>& b) { return a != b.value; }
+
+	//--------------------------------------------------
+	// Functions
+	//--------------------------------------------------
+
+	// The dual overloads would otherwise hide the double versions from templated code within NVLib
+	using std::sqrt; using std::sin; using std::cos; using std::tan; using std::exp;
+	using std::log; using std::abs; using std::pow; using std::atan2;
+
+	template <int N> inline Dual<N> sqrt(const Dual<N>& a) { auto value = std::sqrt(a.value); return Chain(a, value, 0.5 / value); }
+	template <int N> inline Dual<N> sin(const Dual<N>& a) { return Chain(a, std::sin(a.value), std::cos(a.value)); }
+	template <int N> inline Dual<N> cos(const Dual<N>& a) { return Chain(a, std::cos(a.value), -std::sin(a.value)); }
+	template <int N> inline Dual<N> tan(const Dual<N>& a) { auto value = std::tan(a.value); return Chain(a, value, 1 + value * value); }
+	template <int N> inline Dual<N> exp(const Dual<N>& a) { auto value = std::exp(a.value); return Chain(a, value, value); }
+	template <int N> inline Dual<N> log(const Dual<N>& a) { return Chain(a, std::log(a.value), 1.0 / a.value); }
+	template <int N> inline Dual<N> abs(const Dual<N>& a) { return a.value < 0 ? -a : a; }
+	template <int N> inline Dual<N> pow(const Dual<N>& a, double b) { return Chain(a, std::pow(a.value, b), b * std::pow(a.value, b - 1)); }
+
+	template <int N> inline Dual<N> atan2(const Dual<N>& y, const Dual<N>& x)
+	{
+		auto result = Dual<N>(std::atan2(y.value, x.value)); auto scale = 1.0 / (x.value * x.value + y.value * y.value);
+		for (auto i = 0; i < N; i++) result.gradient[i] = (x.value * y.gradient[i] - y.value * x.gradient[i]) * scale;
+		return result;
+	}
+}
@@ -0,0 +1,51 @@
+//--------------------------------------------------
+// The statistics of a single iteration of a refiner
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <iostream>
+using namespace std;
+
+namespace NVLib
+{
+	class IterationStats
+	{
+	private:
+		int _iteration;
+		double _cost;
+		double _gradient;
+		double _step;
+		double _lambda;
+		double _gain;
+		bool _accepted;
+		double _residualTime;
+		double _jacobianTime;
+		double _solveTime;
+	public:
+		IterationStats(int iteration, double cost, double gradient, double step, double lambda, double gain, bool accepted) :
+			_iteration(iteration), _cost(cost), _gradient(gradient), _step(step), _lambda(lambda), _gain(gain), _accepted(accepted) 
+		{
+			_residualTime = 0; _jacobianTime = 0; _solveTime = 0;
+		}
+
+		inline int& GetIteration() { return _iteration; }
+		inline double& GetCost() { return _cost; }
+		inline double& GetGradient() { return _gradient; }
+		inline double& GetStep() { return _step; }
+		inline double& GetLambda() { return _lambda; }
+		inline double& GetGain() { return _gain; }
+		inline bool& GetAccepted() { return _accepted; }
+		inline double& GetResidualTime() { return _residualTime; }
+		inline double& GetJacobianTime() { return _jacobianTime; }
+		inline double& GetSolveTime() { return _solveTime; }
+	};
+
+	/* A callback that is invoked after every solver iteration */
+	typedef function<void(IterationStats&)> IterationCallback;
+}
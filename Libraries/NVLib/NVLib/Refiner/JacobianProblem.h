@@ -0,0 +1,34 @@
+//--------------------------------------------------
+// A refiner problem that can supply its own jacobian rows
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "RefinerProblem.h"
+
+namespace NVLib
+{
+	class JacobianProblem : public RefinerProblem
+	{
+	public:
+
+		/**
+		 * @brief Calculate the error of a training item along with its derivatives
+		 * @param params The current parameters (these are not modified)
+		 * @param problemId The training item that we are evaluating
+		 * @param jacobian The output jacobian row (one entry per parameter)
+		 * @return double The error of the training item
+		 */
+		virtual double GetErrorAndJacobian(Mat& params, int problemId, double * jacobian) = 0;
+	};
+}
@@ -0,0 +1,417 @@
+//--------------------------------------------------
+// Implementation of class LMEngine
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "LMEngine.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Constructors
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param problem The problem that we are solving (the engine takes ownership)
+ * @param epsilon The step used for finite differences (when the problem has no jacobian)
+ * @param tau The scale of the initial damping relative to the largest diagonal entry
+ */
+LMEngine::LMEngine(RefinerProblem * problem, double epsilon, double tau) : _problem(problem), _epsilon(epsilon), _tau(tau)
+{
+	_globalSize = 0; _localSize = 0;
+}
+
+//--------------------------------------------------
+// Minimize
+//--------------------------------------------------
+
+/**
+ * @brief The full minimization loop
+ * @param params The initial parameters (updated in place)
+ * @param maxIterations The maximum number of iterations
+ * @param tolerance The gradient (and step) size that indicates convergence
+ * @return Vec2d The final error (mean, standard deviation)
+ * @remark Damping follows Nielsen's strategy: gentle reduction on success, doubling growth on failure
+ */
+Vec2d LMEngine::Minimize(Mat& params, int maxIterations, double tolerance)
+{
+	_report.Clear(); _report.GetTermination() = "max_iterations"; Setup(params);
+	auto start = getTickCount();
+
+	auto cost = GetCost(params);
+	Accumulate(params);
+
+	auto lambda = _tau * GetMaxDiagonal(); auto nu = 2.0;
+
+	for (auto iteration = 0; iteration < maxIterations; iteration++)
+	{
+		Mat gradient = GetGradient();
+		auto gradientNorm = norm(gradient, NORM_INF);
+		if (gradientNorm < tolerance) { _report.GetTermination() = "gradient"; break; }
+
+		auto ticks = getTickCount();
+		Mat step; auto solved = Solve(lambda, step);
+		auto solveTime = (getTickCount() - ticks) / getTickFrequency();
+		if (!solved) { lambda *= nu; nu *= 2; continue; }
+		auto stepNorm = norm(step);
+
+		// The gain ratio compares the actual reduction with the reduction predicted by the linear model
+		ticks = getTickCount();
+		Mat candidate = params + step;
+		auto candidateCost = GetCost(candidate);
+		auto residualTime = (getTickCount() - ticks) / getTickFrequency();
+
+		auto predicted = 0.5 * step.dot(lambda * step - gradient);
+		auto gain = predicted > 0 ? (cost - candidateCost) / predicted : -1;
+		auto accepted = gain > 0;
+		auto stats = IterationStats(iteration, accepted ? candidateCost : cost, gradientNorm, stepNorm, lambda, gain, accepted);
+
+		if (accepted)
+		{
+			candidate.copyTo(params); cost = candidateCost;
+			ticks = getTickCount();
+			Accumulate(params);
+			stats.GetJacobianTime() = (getTickCount() - ticks) / getTickFrequency();
+			lambda *= std::max(1.0 / 3.0, 1 - pow(2 * gain - 1, 3)); nu = 2;
+		}
+		else
+		{
+			lambda *= nu; nu *= 2;
+		}
+
+		stats.GetResidualTime() = residualTime; stats.GetSolveTime() = solveTime;
+		_report.Add(stats); if (_callback) _callback(stats);
+
+		if (stepNorm < tolerance * (norm(params) + tolerance)) { _report.GetTermination() = "step"; break; }
+	}
+
+	_report.GetTotalTime() = (getTickCount() - start) / getTickFrequency();
+	_report.GetFinalError() = GetAveError(params);
+
+	return _report.GetFinalError();
+}
+
+//--------------------------------------------------
+// Errors
+//--------------------------------------------------
+
+/**
+ * @brief Evaluate the errors of all the training items
+ * @param params The parameters that we are evaluating
+ * @return Mat The errors (one per row)
+ */
+Mat LMEngine::GetErrors(Mat& params)
+{
+	Mat result = Mat_<double>(_problem->GetTrainingSize(), 1);
+	auto output = (double *) result.data;
+
+	auto evaluate = [&](const Range& range)
+	{
+		if (_problem->GetErrors(params, range.start, range.end - range.start, output + range.start)) return;
+		for (auto i = range.start; i < range.end; i++) output[i] = _problem->GetError(params, i);
+	};
+
+	if (_problem->IsReentrant()) parallel_for_(Range(0, result.rows), evaluate, GetStripCount(result.rows));
+	else evaluate(Range(0, result.rows));
+
+	return result;
+}
+
+/**
+ * @brief Calculate the cost (half the sum of squared errors)
+ * @param params The parameters that we are evaluating
+ * @return double The cost
+ */
+double LMEngine::GetCost(Mat& params)
+{
+	Mat errors = GetErrors(params);
+	return 0.5 * errors.dot(errors);
+}
+
+/**
+ * @brief Calculate the average error
+ * @param params The parameters that we are evaluating
+ * @return Vec2d The mean and standard deviation of the errors
+ */
+Vec2d LMEngine::GetAveError(Mat& params)
+{
+	Mat errors = GetErrors(params);
+	auto mean = Scalar(); auto stddev = Scalar();
+	meanStdDev(errors, mean, stddev);
+	return Vec2d(mean[0], stddev[0]);
+}
+
+//--------------------------------------------------
+// Normal Equations
+//--------------------------------------------------
+
+/**
+ * @brief Allocate the normal equation storage for the problem
+ * @param params The parameters of the problem
+ */
+void LMEngine::Setup(Mat& params)
+{
+	if (params.type() != CV_64FC1 || params.cols != 1) throw runtime_error("LMEngine expects a column vector of doubles");
+
+	auto blockProblem = dynamic_cast<BlockProblem *>(_problem);
+	_V.clear(); _W.clear(); _gl.clear(); _blockItems.clear();
+
+	if (blockProblem == nullptr) { _globalSize = params.rows; _localSize = 0; return; }
+
+	_globalSize = blockProblem->GetGlobalSize(); _localSize = blockProblem->GetLocalSize();
+	auto blockCount = blockProblem->GetBlockCount();
+	if (_globalSize + blockCount * _localSize != params.rows) throw runtime_error("Parameter count does not match the block layout");
+
+	// Group the training items by block, so that blocks can be accumulated independently
+	_blockItems.resize(blockCount);
+	for (auto i = 0; i < _problem->GetTrainingSize(); i++) _blockItems[blockProblem->GetLocalBlock(i)].push_back(i);
+
+	for (auto block = 0; block < blockCount; block++)
+	{
+		_V.push_back(Mat_<double>(_localSize, _localSize));
+		_W.push_back(Mat_<double>(_globalSize, _localSize));
+		_gl.push_back(Mat_<double>(_localSize, 1));
+	}
+}
+
+/**
+ * @brief Accumulate JtJ and Jtr for the current parameters without building J
+ * @param params The parameters that we are linearising at
+ */
+void LMEngine::Accumulate(Mat& params)
+{
+	auto blockProblem = dynamic_cast<BlockProblem *>(_problem);
+	if (blockProblem != nullptr) AccumulateBlocks(blockProblem, params);
+	else AccumulateDense(params);
+}
+
+/**
+ * @brief Accumulate the normal equations for a dense problem
+ * @param params The parameters that we are linearising at
+ */
+void LMEngine::AccumulateDense(Mat& params)
+{
+	auto size = _globalSize; auto itemCount = _problem->GetTrainingSize();
+	auto analytic = dynamic_cast<JacobianProblem *>(_problem);
+
+	// Each strip streams its rows into a partial (upper JtJ, Jtr)
+	auto strips = _problem->IsReentrant() ? (int)GetStripCount(itemCount) : 1;
+	Mat partials = Mat_<double>::zeros(strips, size * size + size);
+
+	auto evaluate = [&](const Range& range)
+	{
+		for (auto strip = range.start; strip < range.end; strip++)
+		{
+			Mat local = strips > 1 ? params.clone() : params;
+			auto jacobian = vector<double>(size); auto output = partials.ptr<double>(strip);
+			auto start = strip * itemCount / strips; auto end = (strip + 1) * itemCount / strips;
+
+			for (auto i = start; i < end; i++)
+			{
+				auto error = EvaluateRow(local, i, jacobian.data(), analytic);
+
+				for (auto r = 0; r < size; r++)
+				{
+					for (auto c = r; c < size; c++) output[r * size + c] += jacobian[r] * jacobian[c];
+					output[size * size + r] += jacobian[r] * error;
+				}
+			}
+		}
+	};
+
+	if (strips > 1) parallel_for_(Range(0, strips), evaluate);
+	else evaluate(Range(0, 1));
+
+	Mat total; reduce(partials, total, 0, REDUCE_SUM);
+	auto tdata = (double *) total.data;
+
+	_U = Mat_<double>(size, size); _gg = Mat_<double>(size, 1);
+	auto udata = (double *) _U.data; auto gdata = (double *) _gg.data;
+
+	for (auto r = 0; r < size; r++)
+	{
+		for (auto c = r; c < size; c++) { udata[r * size + c] = tdata[r * size + c]; udata[c * size + r] = tdata[r * size + c]; }
+		gdata[r] = tdata[size * size + r];
+	}
+}
+
+/**
+ * @brief Accumulate the normal equations for a block problem
+ * @param problem The block problem
+ * @param params The parameters that we are linearising at
+ */
+void LMEngine::AccumulateBlocks(BlockProblem * problem, Mat& params)
+{
+	auto globalSize = _globalSize; auto localSize = _localSize;
+	auto blockCount = (int)_blockItems.size();
+
+	auto strips = _problem->IsReentrant() ? (int)std::max(1.0, GetStripCount(blockCount)) : 1;
+	Mat partials = Mat_<double>::zeros(strips, globalSize * globalSize + globalSize);
+
+	// Blocks own their items, so each strip writes to its own blocks and its own global partial
+	parallel_for_(Range(0, strips), [&](const Range& range)
+	{
+		auto globalJ = vector<double>(globalSize); auto localJ = vector<double>(localSize);
+
+		for (auto strip = range.start; strip < range.end; strip++)
+		{
+			auto output = partials.ptr<double>(strip);
+			auto start = strip * blockCount / strips; auto end = (strip + 1) * blockCount / strips;
+
+			for (auto block = start; block < end; block++)
+			{
+				_V[block].setTo(0); _W[block].setTo(0); _gl[block].setTo(0);
+				auto vdata = (double *) _V[block].data; auto wdata = (double *) _W[block].data; auto ldata = (double *) _gl[block].data;
+
+				for (auto item : _blockItems[block])
+				{
+					auto error = problem->GetErrorAndJacobian(params, item, globalJ.data(), localJ.data());
+
+					for (auto r = 0; r < globalSize; r++)
+					{
+						for (auto c = r; c < globalSize; c++) output[r * globalSize + c] += globalJ[r] * globalJ[c];
+						for (auto c = 0; c < localSize; c++) wdata[r * localSize + c] += globalJ[r] * localJ[c];
+						output[globalSize * globalSize + r] += globalJ[r] * error;
+					}
+
+					for (auto r = 0; r < localSize; r++)
+					{
+						for (auto c = 0; c < localSize; c++) vdata[r * localSize + c] += localJ[r] * localJ[c];
+						ldata[r] += localJ[r] * error;
+					}
+				}
+			}
+		}
+	});
+
+	Mat total; reduce(partials, total, 0, REDUCE_SUM);
+	auto tdata = (double *) total.data;
+
+	_U = Mat_<double>(globalSize, globalSize); _gg = Mat_<double>(globalSize, 1);
+	auto udata = (double *) _U.data; auto gdata = (double *) _gg.data;
+
+	for (auto r = 0; r < globalSize; r++)
+	{
+		for (auto c = r; c < globalSize; c++) { udata[r * globalSize + c] = tdata[r * globalSize + c]; udata[c * globalSize + r] = tdata[r * globalSize + c]; }
+		gdata[r] = tdata[globalSize * globalSize + r];
+	}
+}
+
+/**
+ * @brief Evaluate the error and jacobian row of a single training item
+ * @param params The parameters (perturbed and restored when using finite differences)
+ * @param problemId The training item
+ * @param jacobian The output jacobian row
+ * @param analytic The problem as a jacobian problem (nullptr if it has no derivatives)
+ * @return double The error of the training item
+ */
+double LMEngine::EvaluateRow(Mat& params, int problemId, double * jacobian, JacobianProblem * analytic)
+{
+	if (analytic != nullptr) return analytic->GetErrorAndJacobian(params, problemId, jacobian);
+
+	auto pdata = (double *) params.data;
+	auto baseError = _problem->GetError(params, problemId);
+
+	for (auto i = 0; i < params.rows; i++)
+	{
+		auto original = pdata[i];
+		pdata[i] = original + _epsilon;
+		jacobian[i] = (_problem->GetError(params, problemId) - baseError) / _epsilon;
+		pdata[i] = original;
+	}
+
+	return baseError;
+}
+
+//--------------------------------------------------
+// Solving
+//--------------------------------------------------
+
+/**
+ * @brief Solve the damped normal equations for a step
+ * @param lambda The damping factor
+ * @param step The output step
+ * @return true The system was solved
+ * @return false The damped system was not positive definite
+ * @remark Local blocks are eliminated with the Schur complement, so only the global system is solved densely
+ */
+bool LMEngine::Solve(double lambda, Mat& step)
+{
+	auto blockCount = (int)_V.size();
+	step = Mat_<double>::zeros(_globalSize + blockCount * _localSize, 1);
+
+	Mat S = _U + Mat_<double>::eye(_globalSize, _globalSize) * lambda;
+	Mat rhs = -_gg;
+
+	// Eliminate the local blocks
+	auto inverses = vector<Mat>(blockCount);
+	for (auto block = 0; block < blockCount; block++)
+	{
+		Mat V = _V[block] + Mat_<double>::eye(_localSize, _localSize) * lambda;
+		if (invert(V, inverses[block], DECOMP_CHOLESKY) == 0) return false;
+
+		if (_globalSize == 0) continue;
+		Mat WVinv = _W[block] * inverses[block];
+		S -= WVinv * _W[block].t();
+		rhs += WVinv * _gl[block];
+	}
+
+	// Solve the reduced global system
+	Mat globalStep;
+	if (_globalSize > 0)
+	{
+		if (!solve(S, rhs, globalStep, DECOMP_CHOLESKY)) return false;
+		globalStep.copyTo(step.rowRange(0, _globalSize));
+	}
+
+	// Back substitute for the local steps
+	for (auto block = 0; block < blockCount; block++)
+	{
+		Mat localRhs = -_gl[block];
+		if (_globalSize > 0) localRhs -= _W[block].t() * globalStep;
+
+		Mat localStep = inverses[block] * localRhs;
+		auto offset = _globalSize + block * _localSize;
+		localStep.copyTo(step.rowRange(offset, offset + _localSize));
+	}
+
+	return true;
+}
+
+/**
+ * @brief Retrieve the full gradient (Jtr) as a single vector
+ * @return Mat The gradient
+ */
+Mat LMEngine::GetGradient()
+{
+	Mat result = _gg.clone();
+	for (auto& block : _gl) result.push_back(block);
+	return result;
+}
+
+/**
+ * @brief Retrieve the largest diagonal entry of JtJ (used to scale the initial damping)
+ * @return double The largest diagonal entry
+ */
+double LMEngine::GetMaxDiagonal()
+{
+	auto result = 0.0;
+
+	for (auto i = 0; i < _U.rows; i++) result = std::max(result, _U.at<double>(i, i));
+	for (auto& V : _V) for (auto i = 0; i < V.rows; i++) result = std::max(result, V.at<double>(i, i));
+
+	return result > 0 ? result : 1.0;
+}
+
+/**
+ * @brief Determine how many strips the work is split into for parallel evaluation
+ * @param itemCount The number of items being split
+ * @return double The number of strips
+ */
+double LMEngine::GetStripCount(int itemCount)
+{
+	return std::min((double)itemCount, cv::getNumThreads() * 4.0);
+}
@@ -0,0 +1,69 @@
+//--------------------------------------------------
+// A refiner engine based on the Levenberg-Marquardt approach (streamed normal equations)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "RefinerProblem.h"
+#include "JacobianProblem.h"
+#include "BlockProblem.h"
+#include "IterationStats.h"
+#include "SolverReport.h"
+
+namespace NVLib
+{
+	class LMEngine
+	{
+	private:
+		RefinerProblem * _problem;
+		double _epsilon;
+		double _tau;
+		SolverReport _report;
+		IterationCallback _callback;
+		int _globalSize;
+		int _localSize;
+		Mat _U;
+		Mat _gg;
+		vector<Mat> _V;
+		vector<Mat> _W;
+		vector<Mat> _gl;
+		vector<vector<int>> _blockItems;
+	public:
+		LMEngine(RefinerProblem * problem, double epsilon = 1e-8, double tau = 1e-3);
+		virtual ~LMEngine() { delete _problem; }
+
+		Vec2d Minimize(Mat& params, int maxIterations = 100, double tolerance = 1e-10);
+
+		Mat GetErrors(Mat& params);
+		double GetCost(Mat& params);
+		Vec2d GetAveError(Mat& params);
+
+		inline RefinerProblem *& GetProblem() { return _problem; }
+		inline double& GetEpsilon() { return _epsilon; }
+		inline double& GetTau() { return _tau; }
+		inline vector<IterationStats>& GetStats() { return _report.GetIterations(); }
+		inline SolverReport& GetReport() { return _report; }
+		inline void SetCallback(IterationCallback callback) { _callback = callback; }
+	private:
+		void Setup(Mat& params);
+		void Accumulate(Mat& params);
+		void AccumulateDense(Mat& params);
+		void AccumulateBlocks(BlockProblem * problem, Mat& params);
+		double EvaluateRow(Mat& params, int problemId, double * jacobian, JacobianProblem * analytic);
+
+		bool Solve(double lambda, Mat& step);
+		Mat GetGradient();
+		double GetMaxDiagonal();
+		double GetStripCount(int itemCount);
+	};
+}
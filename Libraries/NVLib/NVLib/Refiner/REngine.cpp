@@ -50,19 +50,49 @@ Mat REngine::GetJacobian(Mat& parameters, double baseError, int problemId)
  */
 Mat REngine::GetErrors(Mat& parameters)
 {
-	auto pcount = parameters.rows; 
 	Mat result = Mat_<double>(_problem->GetTrainingSize(), 1);
 	auto output = (double *) result.data;
 
-	for (auto i = 0; i < result.rows; i++) 
+	if (!_problem->IsReentrant()) 
 	{
-		auto error = _problem->GetError(parameters, i);
-		output[i] = error;
+		GetErrors(parameters, Range(0, result.rows), output);
+		return result;
 	}
 
+	// Evaluating errors does not modify the parameters, so the workers can share them
+	parallel_for_(Range(0, result.rows), [&](const Range& range) 
+	{
+		GetErrors(parameters, range, output);
+	}, GetStripCount(result.rows));
+
 	return result;
 }
 
+/**
+ * @brief Evaluate a range of errors, using the batched problem interface when it is available
+ * @param parameters The parameters that we are evaluating
+ * @param range The range of training items
+ * @param output The output errors (indexed by training item)
+ * @return true The batched interface was used
+ * @return false The errors were evaluated one at a time
+ */
+bool REngine::GetErrors(Mat& parameters, const Range& range, double * output) 
+{
+	if (_problem->GetErrors(parameters, range.start, range.end - range.start, output + range.start)) return true;
+	for (auto i = range.start; i < range.end; i++) output[i] = _problem->GetError(parameters, i);
+	return false;
+}
+
+/**
+ * @brief Determine how many strips the training items are split into for parallel evaluation
+ * @param itemCount The number of training items
+ * @return double The number of strips
+ */
+double REngine::GetStripCount(int itemCount) 
+{
+	return std::min((double)itemCount, cv::getNumThreads() * 4.0);
+}
+
 /**
  * @brief Calculate the average error 
  * @param errors The errors that we are calculating
@@ -88,23 +118,109 @@ Vec2d REngine::GetAveError(Mat& errors)
  */
 Mat REngine::Iterate(Mat& parameters, Mat& errors)
 {
-	// Calculate the error vector
-	auto rdata = (double *)errors.data;
-
 	// Build up the jacobian
-	Mat J; for (auto i = 0; i < _problem->GetTrainingSize(); i++) 
-	{
-		Mat entry = GetJacobian(parameters, rdata[i], i);
-		J.push_back(entry);
-	}
+	auto ticks = getTickCount();
+	Mat J = BuildJacobian(parameters, errors);
+	_jacobianTime = (getTickCount() - ticks) / getTickFrequency();
+
+	// The gradient norm is reported with the stats, but is not part of the solve timing
+	_gradientNorm = norm(J.t() * errors, NORM_INF);
 
 	// Determine the update
-	Mat u; solve(J, errors, u, DECOMP_SVD);
+	ticks = getTickCount();
+	Mat u = Solve(J, errors);
+	_solveTime = (getTickCount() - ticks) / getTickFrequency();
 
 	// Return the result
 	return parameters - u;
 }
 
+/**
+ * @brief Build the jacobian for the current parameters
+ * @param parameters The current parameters
+ * @param errors The errors at the current parameters
+ * @return Mat The jacobian (one row per training item)
+ */
+Mat REngine::BuildJacobian(Mat& parameters, Mat& errors)
+{
+	// Calculate the error vector
+	auto rdata = (double *)errors.data;
+
+	// Problems that supply their own derivatives avoid the finite difference evaluations
+	auto analytic = dynamic_cast<JacobianProblem *>(_problem);
+
+	// Build up the jacobian (each worker perturbs its own copy of the parameters)
+	Mat J = Mat_<double>(_problem->GetTrainingSize(), parameters.rows);
+	if (analytic == nullptr && GetBatchJacobian(parameters, errors, J)) return J;
+
+	auto evaluate = [&](const Range& range) 
+	{
+		Mat local = _problem->IsReentrant() ? parameters.clone() : parameters;
+
+		for (auto i = range.start; i < range.end; i++) 
+		{
+			if (analytic != nullptr) { analytic->GetErrorAndJacobian(local, i, J.ptr<double>(i)); continue; }
+			Mat entry = GetJacobian(local, rdata[i], i);
+			entry.copyTo(J.row(i));
+		}
+	};
+
+	if (_problem->IsReentrant()) parallel_for_(Range(0, J.rows), evaluate, GetStripCount(J.rows));
+	else evaluate(Range(0, J.rows));
+
+	return J;
+}
+
+/**
+ * @brief Build a finite difference jacobian a column at a time using the batched error interface
+ * @param parameters The current parameters
+ * @param errors The errors at the current parameters
+ * @param J The output jacobian
+ * @return true The jacobian was built
+ * @return false The problem does not support batching
+ */
+bool REngine::GetBatchJacobian(Mat& parameters, Mat& errors, Mat& J) 
+{
+	auto count = J.rows; auto base = (double *) errors.data;
+
+	// Check that batching is supported before committing to it
+	auto column = vector<double>(count);
+	if (!_problem->GetErrors(parameters, 0, 0, column.data())) return false;
+
+	auto evaluate = [&](const Range& range) 
+	{
+		Mat local = parameters.clone(); auto pdata = (double *) local.data;
+		auto output = vector<double>(count);
+
+		for (auto p = range.start; p < range.end; p++) 
+		{
+			auto original = pdata[p];
+			pdata[p] = original + _epsilon;
+			_problem->GetErrors(local, 0, count, output.data());
+			pdata[p] = original;
+
+			for (auto i = 0; i < count; i++) J.at<double>(i, p) = (output[i] - base[i]) / _epsilon;
+		}
+	};
+
+	if (_problem->IsReentrant()) parallel_for_(Range(0, J.cols), evaluate);
+	else evaluate(Range(0, J.cols));
+
+	return true;
+}
+
+/**
+ * @brief Determine the update from the jacobian
+ * @param J The jacobian
+ * @param errors The current errors
+ * @return Mat The update that is subtracted from the parameters
+ */
+Mat REngine::Solve(Mat& J, Mat& errors) 
+{
+	Mat u; solve(J, errors, u, DECOMP_SVD);
+	return u;
+}
+
 //--------------------------------------------------
 // Minimize
 //--------------------------------------------------
@@ -115,19 +231,36 @@ Mat REngine::Iterate(Mat& parameters, Mat& errors)
  * @param maxIterations The list of maximum iterations
  * @param minError The minimum error that indicates we are good enough
  * @return double Returns a double
+ * @remark A trace of the run is kept in the report, and the callback (if set) is invoked after every iteration
  */
 Vec2d REngine::Minimize(Mat& parameters, int maxIterations, double minError)
 {
 	auto error = Vec2d(1e6, 1e6);
+	_report.Clear(); _report.GetTermination() = "max_iterations";
+	auto start = getTickCount();
 
 	for (auto i = 0; i < maxIterations; i++) 
 	{
+		auto ticks = getTickCount();
 		Mat R = GetErrors(parameters);
+		auto residualTime = (getTickCount() - ticks) / getTickFrequency();
+
 		error = GetAveError(R);	
-		if (error[0] < minError) break;
-		parameters = Iterate(parameters, R);
+		if (error[0] < minError) { _report.GetTermination() = "converged"; break; }
+
+		Mat next = Iterate(parameters, R);
+		auto step = norm(next - parameters);
+		parameters = next;
+
+		auto stats = IterationStats(i, 0.5 * R.dot(R), _gradientNorm, step, 0, 0, true);
+		stats.GetResidualTime() = residualTime; stats.GetJacobianTime() = _jacobianTime; stats.GetSolveTime() = _solveTime;
+		_report.Add(stats);
+
+		if (_callback) _callback(stats);
 	}
 
+	_report.GetTotalTime() = (getTickCount() - start) / getTickFrequency();
+	_report.GetFinalError() = error;
+
 	return error;
 }
-
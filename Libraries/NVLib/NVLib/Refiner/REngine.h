@@ -15,6 +15,9 @@ using namespace std;
 using namespace cv;
 
 #include "RefinerProblem.h"
+#include "JacobianProblem.h"
+#include "IterationStats.h"
+#include "SolverReport.h"
 
 namespace NVLib
 {
@@ -23,8 +26,13 @@ namespace NVLib
 	private:
 		RefinerProblem * _problem;
 		double _epsilon;
+		SolverReport _report;
+		IterationCallback _callback;
+		double _jacobianTime;
+		double _solveTime;
+		double _gradientNorm;
 	public:
-		REngine(RefinerProblem * problem, double epsilon=1e-8) : _problem(problem), _epsilon(epsilon) {}
+		REngine(RefinerProblem * problem, double epsilon=1e-8) : _problem(problem), _epsilon(epsilon) { _jacobianTime = _solveTime = _gradientNorm = 0; }
 		virtual ~REngine() { delete _problem; }
 
 		Mat GetJacobian(Mat& params, double baseError, int problemId);
@@ -36,5 +44,13 @@ namespace NVLib
 
 		inline RefinerProblem *& GetProblem() { return _problem; }
 		inline double& GetEpsilon() { return _epsilon; }
+		inline SolverReport& GetReport() { return _report; }
+		inline void SetCallback(IterationCallback callback) { _callback = callback; }
+	private:
+		Mat BuildJacobian(Mat& params, Mat& errors);
+		bool GetErrors(Mat& params, const Range& range, double * output);
+		bool GetBatchJacobian(Mat& params, Mat& errors, Mat& J);
+		Mat Solve(Mat& J, Mat& errors);
+		double GetStripCount(int itemCount);
 	};
 }
@@ -19,7 +19,27 @@ namespace NVLib
 	class RefinerProblem
 	{
 	public:
+		virtual ~RefinerProblem() {}
+
 		virtual double GetError(Mat& params, int problemId) = 0;
 		virtual int GetTrainingSize() = 0;
+
+		/**
+		 * @brief Calculate the errors of a contiguous range of training items in one call
+		 * @param params The current parameters
+		 * @param start The first training item
+		 * @param count The number of training items
+		 * @param output The output errors (count entries)
+		 * @return true The batch was evaluated
+		 * @return false The problem does not support batching (the scalar GetError is used instead)
+		 * @remark The engine probes for support with a zero count
+		 */
+		virtual bool GetErrors(Mat& /*params*/, int /*start*/, int /*count*/, double * /*output*/) { return false; }
+
+		/**
+		 * @brief Indicates whether GetError may be called concurrently (with different parameter Mats)
+		 * @return true The problem is safe to evaluate from multiple threads
+		 */
+		virtual bool IsReentrant() { return false; }
 	};
 }
\ No newline at end of file
@@ -0,0 +1,116 @@
+//--------------------------------------------------
+// Implementation of class SolverReport
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "SolverReport.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Clear
+//--------------------------------------------------
+
+/**
+ * @brief Reset the report for a new run
+ */
+void SolverReport::Clear()
+{
+	_iterations.clear(); _termination = "none"; _totalTime = 0; _finalError = Vec2d(0, 0);
+}
+
+//--------------------------------------------------
+// Export
+//--------------------------------------------------
+
+/**
+ * @brief Render the iterations as CSV (one row per iteration, times in milliseconds)
+ * @return string The resultant CSV
+ */
+string SolverReport::GetCsv()
+{
+	auto writer = stringstream();
+
+	writer << "iteration,cost,gradient,step,lambda,gain,accepted,residual_ms,jacobian_ms,solve_ms" << endl;
+
+	for (auto& stats : _iterations)
+	{
+		writer << stats.GetIteration() << "," << EscapeUtils::CsvNumber(stats.GetCost()) << "," << EscapeUtils::CsvNumber(stats.GetGradient()) << ",";
+		writer << EscapeUtils::CsvNumber(stats.GetStep()) << "," << EscapeUtils::CsvNumber(stats.GetLambda()) << "," << EscapeUtils::CsvNumber(stats.GetGain()) << ",";
+		writer << (stats.GetAccepted() ? 1 : 0) << "," << EscapeUtils::CsvNumber(stats.GetResidualTime() * 1000) << ",";
+		writer << EscapeUtils::CsvNumber(stats.GetJacobianTime() * 1000) << "," << EscapeUtils::CsvNumber(stats.GetSolveTime() * 1000) << endl;
+	}
+
+	return writer.str();
+}
+
+/**
+ * @brief Render the report as JSON (times in milliseconds)
+ * @return string The resultant JSON
+ */
+string SolverReport::GetJson()
+{
+	auto writer = stringstream();
+
+	writer << "{" << endl;
+	writer << "  \"termination\": \"" << _termination << "\"," << endl;
+	writer << "  \"total_ms\": " << EscapeUtils::JsonNumber(_totalTime * 1000) << "," << endl;
+	writer << "  \"final_error\": { \"mean\": " << EscapeUtils::JsonNumber(_finalError[0]) << ", \"stddev\": " << EscapeUtils::JsonNumber(_finalError[1]) << " }," << endl;
+	writer << "  \"iterations\": [";
+
+	for (auto i = 0; i < (int)_iterations.size(); i++)
+	{
+		auto& stats = _iterations[i];
+
+		writer << (i == 0 ? "" : ",") << endl << "    { ";
+		writer << "\"iteration\": " << stats.GetIteration() << ", \"cost\": " << EscapeUtils::JsonNumber(stats.GetCost()) << ", ";
+		writer << "\"gradient\": " << EscapeUtils::JsonNumber(stats.GetGradient()) << ", \"step\": " << EscapeUtils::JsonNumber(stats.GetStep()) << ", ";
+		writer << "\"lambda\": " << EscapeUtils::JsonNumber(stats.GetLambda()) << ", \"gain\": " << EscapeUtils::JsonNumber(stats.GetGain()) << ", ";
+		writer << "\"accepted\": " << (stats.GetAccepted() ? "true" : "false") << ", ";
+		writer << "\"residual_ms\": " << EscapeUtils::JsonNumber(stats.GetResidualTime() * 1000) << ", ";
+		writer << "\"jacobian_ms\": " << EscapeUtils::JsonNumber(stats.GetJacobianTime() * 1000) << ", ";
+		writer << "\"solve_ms\": " << EscapeUtils::JsonNumber(stats.GetSolveTime() * 1000) << " }";
+	}
+
+	writer << (_iterations.empty() ? "" : "\n  ") << "]" << endl;
+	writer << "}" << endl;
+
+	return writer.str();
+}
+
+/**
+ * @brief Save the iterations as a CSV file
+ * @param path The path that we are saving to
+ */
+void SolverReport::SaveCsv(const string& path)
+{
+	Save(path, GetCsv());
+}
+
+/**
+ * @brief Save the report as a JSON file
+ * @param path The path that we are saving to
+ */
+void SolverReport::SaveJson(const string& path)
+{
+	Save(path, GetJson());
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Write content to disk
+ * @param path The path that we are writing to
+ * @param content The content being written
+ */
+void SolverReport::Save(const string& path, const string& content)
+{
+	auto writer = ofstream(path);
+	if (!writer.is_open()) throw runtime_error("Unable to open: " + path);
+	writer << content;
+	writer.close();
+}
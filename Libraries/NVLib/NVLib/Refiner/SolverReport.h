@@ -0,0 +1,52 @@
+//--------------------------------------------------
+// A trace of a solver run that can be exported as CSV or JSON
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include <iomanip>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "IterationStats.h"
+#include "../EscapeUtils.h"
+
+namespace NVLib
+{
+	class SolverReport
+	{
+	private:
+		vector<IterationStats> _iterations;
+		string _termination;
+		double _totalTime;
+		Vec2d _finalError;
+	public:
+		SolverReport() : _termination("none"), _totalTime(0), _finalError(0, 0) {}
+
+		inline void Add(const IterationStats& stats) { _iterations.push_back(stats); }
+		void Clear();
+
+		string GetCsv();
+		string GetJson();
+		void SaveCsv(const string& path);
+		void SaveJson(const string& path);
+
+		inline vector<IterationStats>& GetIterations() { return _iterations; }
+		inline string& GetTermination() { return _termination; }
+		inline double& GetTotalTime() { return _totalTime; }
+		inline Vec2d& GetFinalError() { return _finalError; }
+	private:
+		static void Save(const string& path, const string& content);
+	};
+}
@@ -0,0 +1,245 @@
+//--------------------------------------------------
+// Implementation of class RegionStats
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "RegionStats.h"
+using namespace NVLib;
+
+//--------------------------------------------------
+// Constructors
+//--------------------------------------------------
+
+/**
+ * @brief Default Constructor (an empty cache that is filled with Build)
+ */
+RegionStats::RegionStats() : _size(0, 0)
+{
+	// Extra implementation can go here
+}
+
+/**
+ * @brief Main Constructor
+ * @param image The single channel image (mask or depth map) that we are caching
+ */
+RegionStats::RegionStats(Mat& image) : _size(0, 0)
+{
+	Build(image);
+}
+
+//--------------------------------------------------
+// Build
+//--------------------------------------------------
+
+/**
+ * @brief Build the integral images for the given image
+ * @param image The single channel image (8-bit, 16-bit, float or double)
+ * @remark The tables are reused when the image size does not change, so a cache can be rebuilt each frame.
+ * A pixel is "valid" when it is non-zero (and not NaN), which matches the usual depth map and mask conventions.
+ */
+void RegionStats::Build(Mat& image)
+{
+	auto depth = image.depth();
+	if (image.channels() != 1) throw runtime_error("Region statistics require a single channel image");
+	if (depth != CV_8U && depth != CV_16U && depth != CV_32F && depth != CV_64F) throw runtime_error("Region statistics only support 8-bit, 16-bit, float and double images");
+
+	_size = image.size();
+
+	_sum.create(image.rows + 1, image.cols + 1, CV_64FC1);
+	_squareSum.create(image.rows + 1, image.cols + 1, CV_64FC1);
+	_count.create(image.rows + 1, image.cols + 1, CV_32SC1);
+
+	// The first row is the zero border of the tables
+	_sum.row(0).setTo(0); _squareSum.row(0).setTo(0); _count.row(0).setTo(0);
+
+	// Rows are summed independently, and then the columns are summed in independent blocks
+	parallel_for_(Range(0, image.rows), [&](const Range& range) { BuildRows(image, range); });
+	parallel_for_(Range(1, image.cols + 1), [&](const Range& range) { BuildColumns(range); });
+}
+
+/**
+ * @brief Fill the tables with the running sums along each row
+ * @param image The image that we are caching
+ * @param rows The rows of the image that we are processing
+ */
+void RegionStats::BuildRows(Mat& image, const Range& rows)
+{
+	for (auto row = rows.start; row < rows.end; row++)
+	{
+		switch (image.depth())
+		{
+			case CV_8U: AccumulateRow(image.ptr<uchar>(row), row); break;
+			case CV_16U: AccumulateRow(image.ptr<ushort>(row), row); break;
+			case CV_32F: AccumulateRow(image.ptr<float>(row), row); break;
+			default: AccumulateRow(image.ptr<double>(row), row); break;
+		}
+	}
+}
+
+/**
+ * @brief Find the running sums along a single row
+ * @param input The row of the image
+ * @param row The index of the row within the image
+ */
+template <typename T> void RegionStats::AccumulateRow(const T * input, int row)
+{
+	auto sum = _sum.ptr<double>(row + 1); auto squareSum = _squareSum.ptr<double>(row + 1); auto count = _count.ptr<int>(row + 1);
+
+	sum[0] = 0; squareSum[0] = 0; count[0] = 0;
+
+	for (auto column = 0; column < _size.width; column++)
+	{
+		auto value = (double)input[column];
+		auto valid = value != 0 && value == value;
+		if (!valid) value = 0;
+
+		sum[column + 1] = sum[column] + value;
+		squareSum[column + 1] = squareSum[column] + value * value;
+		count[column + 1] = count[column] + (valid ? 1 : 0);
+	}
+}
+
+/**
+ * @brief Add each row of the tables onto the row below it (for a block of columns)
+ * @param columns The columns of the tables that we are processing
+ */
+void RegionStats::BuildColumns(const Range& columns)
+{
+	for (auto row = 2; row <= _size.height; row++)
+	{
+		auto sumAbove = _sum.ptr<double>(row - 1); auto sum = _sum.ptr<double>(row);
+		auto squareAbove = _squareSum.ptr<double>(row - 1); auto squareSum = _squareSum.ptr<double>(row);
+		auto countAbove = _count.ptr<int>(row - 1); auto count = _count.ptr<int>(row);
+
+		for (auto column = columns.start; column < columns.end; column++)
+		{
+			sum[column] += sumAbove[column];
+			squareSum[column] += squareAbove[column];
+			count[column] += countAbove[column];
+		}
+	}
+}
+
+//--------------------------------------------------
+// Region Queries
+//--------------------------------------------------
+
+/**
+ * @brief Get the sum of the values within a region
+ * @param region The region that we are querying (clipped to the image)
+ * @return double The resultant sum
+ */
+double RegionStats::GetSum(const Rect& region) const
+{
+	return Lookup<double>(_sum, Clip(region));
+}
+
+/**
+ * @brief Get the sum of the squared values within a region
+ * @param region The region that we are querying (clipped to the image)
+ * @return double The resultant sum
+ */
+double RegionStats::GetSquareSum(const Rect& region) const
+{
+	return Lookup<double>(_squareSum, Clip(region));
+}
+
+/**
+ * @brief Get the number of valid (non-zero) pixels within a region
+ * @param region The region that we are querying (clipped to the image)
+ * @return int The number of valid pixels
+ */
+int RegionStats::GetCount(const Rect& region) const
+{
+	return Lookup<int>(_count, Clip(region));
+}
+
+/**
+ * @brief Get the number of pixels that the region covers within the image
+ * @param region The region that we are querying (clipped to the image)
+ * @return int The number of pixels
+ */
+int RegionStats::GetArea(const Rect& region) const
+{
+	return Clip(region).area();
+}
+
+/**
+ * @brief Get the mean value of all the pixels within a region
+ * @param region The region that we are querying (clipped to the image)
+ * @return double The resultant mean (zero for an empty region)
+ */
+double RegionStats::GetMean(const Rect& region) const
+{
+	auto area = GetArea(region); if (area == 0) return 0;
+	return GetSum(region) / area;
+}
+
+/**
+ * @brief Get the mean value of the valid (non-zero) pixels within a region
+ * @param region The region that we are querying (clipped to the image)
+ * @return double The resultant mean (zero if there are no valid pixels)
+ */
+double RegionStats::GetValidMean(const Rect& region) const
+{
+	auto count = GetCount(region); if (count == 0) return 0;
+	return GetSum(region) / count;
+}
+
+/**
+ * @brief Get the variance of all the pixels within a region
+ * @param region The region that we are querying (clipped to the image)
+ * @return double The resultant variance (zero for an empty region)
+ */
+double RegionStats::GetVariance(const Rect& region) const
+{
+	auto area = GetArea(region); if (area == 0) return 0;
+	auto mean = GetSum(region) / area;
+	return std::max(0.0, GetSquareSum(region) / area - mean * mean);
+}
+
+/**
+ * @brief Get the variance of the valid (non-zero) pixels within a region
+ * @param region The region that we are querying (clipped to the image)
+ * @return double The resultant variance (zero if there are no valid pixels)
+ */
+double RegionStats::GetValidVariance(const Rect& region) const
+{
+	auto count = GetCount(region); if (count == 0) return 0;
+	auto mean = GetSum(region) / count;
+	return std::max(0.0, GetSquareSum(region) / count - mean * mean);
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Clip a region to the bounds of the cached image
+ * @param region The region that we are clipping
+ * @return Rect The clipped region
+ */
+Rect RegionStats::Clip(const Rect& region) const
+{
+	if (_sum.empty()) throw runtime_error("The region statistics have not been built");
+	return region & Rect(0, 0, _size.width, _size.height);
+}
+
+/**
+ * @brief Evaluate the sum of a (clipped) region from one of the integral tables
+ * @param table The integral table
+ * @param region The region that we are evaluating
+ * @return T The resultant sum
+ */
+template <typename T> T RegionStats::Lookup(const Mat& table, const Rect& region) const
+{
+	if (region.area() == 0) return 0;
+
+	auto top = table.ptr<T>(region.y); auto bottom = table.ptr<T>(region.y + region.height);
+	auto left = region.x; auto right = region.x + region.width;
+
+	return bottom[right] - bottom[left] - top[right] + top[left];
+}
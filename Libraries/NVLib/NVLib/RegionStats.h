@@ -0,0 +1,52 @@
+//--------------------------------------------------
+// A cache of integral images that answers rectangular region queries (sums, means, valid counts) in constant time
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVLib
+{
+	class RegionStats
+	{
+	private:
+		Size _size;
+		Mat _sum;
+		Mat _squareSum;
+		Mat _count;
+	public:
+		RegionStats();
+		RegionStats(Mat& image);
+
+		void Build(Mat& image);
+
+		double GetSum(const Rect& region) const;
+		double GetSquareSum(const Rect& region) const;
+		int GetCount(const Rect& region) const;
+		int GetArea(const Rect& region) const;
+
+		double GetMean(const Rect& region) const;
+		double GetValidMean(const Rect& region) const;
+		double GetVariance(const Rect& region) const;
+		double GetValidVariance(const Rect& region) const;
+
+		inline Size& GetSize() { return _size; }
+		inline bool IsEmpty() const { return _sum.empty(); }
+	private:
+		Rect Clip(const Rect& region) const;
+		void BuildRows(Mat& image, const Range& rows);
+		void BuildColumns(const Range& columns);
+
+		template <typename T> void AccumulateRow(const T * input, int row);
+		template <typename T> T Lookup(const Mat& table, const Rect& region) const;
+	};
+}
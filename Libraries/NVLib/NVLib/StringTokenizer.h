@@ -0,0 +1,156 @@
+//--------------------------------------------------
+// A tokenizer that splits text into string_views without copying it
+//
+// @author: Wild Boar
+//--------------------------------------------------
+
+#pragma once
+
+#include <iterator>
+#include <string_view>
+#include <vector>
+#include <iostream>
+using namespace std;
+
+namespace NVLib
+{
+	class StringTokenizer
+	{
+	public:
+
+		/* Defines how tokens are separated */
+		enum class Mode { CHARACTER, TOKEN, WHITESPACE };
+
+		/* Defines a forward iterator over the tokens (so the tokenizer can be used in a range based for) */
+		class Iterator
+		{
+		private:
+			StringTokenizer * _tokenizer;
+			string_view _token;
+		public:
+			using iterator_category = input_iterator_tag;
+			using value_type = string_view;
+			using difference_type = ptrdiff_t;
+			using pointer = const string_view *;
+			using reference = const string_view&;
+
+			Iterator(StringTokenizer * tokenizer) : _tokenizer(tokenizer) { ++(*this); }
+
+			inline const string_view& operator*() const { return _token; }
+			inline const string_view * operator->() const { return &_token; }
+			inline Iterator& operator++() { if (_tokenizer != nullptr && !_tokenizer->Next(_token)) _tokenizer = nullptr; return *this; }
+			inline bool operator==(const Iterator& other) const { return _tokenizer == other._tokenizer; }
+			inline bool operator!=(const Iterator& other) const { return _tokenizer != other._tokenizer; }
+		};
+
+	private:
+
+		/* Constant */
+		inline static const string_view WHITESPACE_CHARACTERS = " \t\r\n";
+
+	private:
+		string_view _text;
+		string_view _delimiter;
+		char _character;
+		Mode _mode;
+		size_t _position;
+	public:
+
+		/**
+		 * @brief Split on a single character (empty fields between delimiters are kept, a trailing empty field is not)
+		 * @param text The text that we are splitting (it must outlive the tokenizer)
+		 * @param delimiter The delimiter character
+		 */
+		StringTokenizer(string_view text, char delimiter) : _text(text), _character(delimiter), _mode(Mode::CHARACTER), _position(0) {}
+
+		/**
+		 * @brief Split on a multi-character delimiter (with the same empty field rules as the single character version)
+		 * @param text The text that we are splitting (it must outlive the tokenizer)
+		 * @param delimiter The delimiter sequence
+		 */
+		StringTokenizer(string_view text, string_view delimiter) : _text(text), _delimiter(delimiter), _character(0), _mode(Mode::TOKEN), _position(0)
+		{
+			if (delimiter.empty()) throw runtime_error("The tokenizer delimiter cannot be empty");
+		}
+
+		/**
+		 * @brief Create a tokenizer that splits on runs of whitespace (no empty tokens are returned)
+		 * @param text The text that we are splitting (it must outlive the tokenizer)
+		 * @return StringTokenizer The resultant tokenizer
+		 */
+		static StringTokenizer Whitespace(string_view text)
+		{
+			auto result = StringTokenizer(text, ' '); result._mode = Mode::WHITESPACE;
+			return result;
+		}
+
+		/**
+		 * @brief Retrieve the next token
+		 * @param token The token that was found
+		 * @return true A token was found
+		 * @return false There are no more tokens
+		 */
+		bool Next(string_view& token)
+		{
+			if (_mode == Mode::WHITESPACE)
+			{
+				auto start = _text.find_first_not_of(WHITESPACE_CHARACTERS, _position);
+				if (start == string_view::npos) { _position = _text.size(); return false; }
+
+				auto end = _text.find_first_of(WHITESPACE_CHARACTERS, start);
+				if (end == string_view::npos) end = _text.size();
+
+				token = _text.substr(start, end - start); _position = end;
+				return true;
+			}
+
+			if (_position >= _text.size()) return false;
+
+			auto found = _mode == Mode::CHARACTER ? _text.find(_character, _position) : _text.find(_delimiter, _position);
+			auto length = _mode == Mode::CHARACTER ? 1 : _delimiter.size();
+
+			if (found == string_view::npos)
+			{
+				token = _text.substr(_position); _position = _text.size();
+				return true;
+			}
+
+			token = _text.substr(_position, found - _position); _position = found + length;
+			return true;
+		}
+
+		/**
+		 * @brief Fill a caller owned array with tokens
+		 * @param output The array that we are filling
+		 * @param capacity The number of entries in the array
+		 * @return int The number of tokens written (further tokens can still be retrieved with Next)
+		 */
+		int Fill(string_view * output, int capacity)
+		{
+			auto count = 0;
+			while (count < capacity && Next(output[count])) count++;
+			return count;
+		}
+
+		/**
+		 * @brief Fill a reusable vector with the remaining tokens
+		 * @param output The vector that we are filling (it is cleared first, but keeps its capacity)
+		 * @return int The number of tokens found
+		 */
+		int Fill(vector<string_view>& output)
+		{
+			output.clear(); auto token = string_view();
+			while (Next(token)) output.push_back(token);
+			return (int)output.size();
+		}
+
+		/**
+		 * @brief Start tokenizing from the beginning of the text again
+		 */
+		inline void Reset() { _position = 0; }
+
+		inline Iterator begin() { return Iterator(this); }
+		inline Iterator end() { return Iterator(nullptr); }
+		inline Mode GetMode() { return _mode; }
+	};
+}
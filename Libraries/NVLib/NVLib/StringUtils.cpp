@@ -19,15 +19,43 @@ using namespace NVLib;
  */
 void StringUtils::Split(const string & value, char delimiter, vector<string> & output)
 {
-    size_t pos = 0; auto s = string(value);
-    while ((pos = s.find(delimiter)) != string::npos) 
-    {
-        auto token = s.substr(0, pos);
-        output.push_back(token);
-        s.erase(0, pos + 1);
-    }
+    auto tokenizer = StringTokenizer(value, delimiter); auto token = string_view();
+    while (tokenizer.Next(token)) output.push_back(string(token));
+}
+
+/**
+ * @brief Split a string into views of its parts (without copying any of the text)
+ * @param value The value that we are splitting (it must outlive the output)
+ * @param delimiter The delimiter we are working with
+ * @param output The resultant tokens (cleared first, so it can be reused between lines)
+ * @return int The number of tokens found
+ */
+int StringUtils::Split(string_view value, char delimiter, vector<string_view> & output)
+{
+    return StringTokenizer(value, delimiter).Fill(output);
+}
+
+/**
+ * @brief Split a string on a multi-character delimiter into views of its parts
+ * @param value The value that we are splitting (it must outlive the output)
+ * @param delimiter The delimiter sequence we are working with
+ * @param output The resultant tokens (cleared first, so it can be reused between lines)
+ * @return int The number of tokens found
+ */
+int StringUtils::Split(string_view value, string_view delimiter, vector<string_view> & output)
+{
+    return StringTokenizer(value, delimiter).Fill(output);
+}
 
-    if (s.length() != 0) output.push_back(s);
+/**
+ * @brief Split a string on runs of whitespace into views of its parts
+ * @param value The value that we are splitting (it must outlive the output)
+ * @param output The resultant tokens (cleared first, so it can be reused between lines)
+ * @return int The number of tokens found
+ */
+int StringUtils::SplitWhitespace(string_view value, vector<string_view> & output)
+{
+    return StringTokenizer::Whitespace(value).Fill(output);
 }
 
 //--------------------------------------------------
@@ -224,11 +252,10 @@ string StringUtils::GetDateString()
  * @param value The value that is being converted
  * @return The resultant integer
  */
-int StringUtils::String2Int(const string& value)
+int StringUtils::String2Int(string_view value)
 {
-    auto converter = stringstream(value);
-    int result; converter >> result;
-    if (converter.fail()) throw runtime_error("Integer conversion failed: " + value);
+    auto result = 0;
+    if (!TryParse(value, result)) throw runtime_error("Integer conversion failed: " + string(value));
     return result;
 }
 
@@ -239,12 +266,12 @@ int StringUtils::String2Int(const string& value)
 /**
  * @brief Logic to convert a string into a double
  * @param value The value that we are converting
- * @return The resultant double that we have converted
+ * @return The resultant double that we have converted (zero if the value is not a number)
  */
-double StringUtils::String2Double(const string& value) 
+double StringUtils::String2Double(string_view value) 
 {
-    auto converter = stringstream(value);
-    double result; converter >> result;
+    auto result = 0.0;
+    if (!TryParse(value, result)) return 0;
     return result;
 }
 
@@ -259,9 +286,8 @@ double StringUtils::String2Double(const string& value)
  */
 string StringUtils::Int2String(int value) 
 {
-    auto converter = stringstream();
-    converter << value;
-    return converter.str();
+    char buffer[16];
+    return string(buffer, FormatNumber(buffer, buffer + sizeof(buffer), value));
 }
 
 //----------------------------------------------------------------------------------
@@ -271,13 +297,145 @@ string StringUtils::Int2String(int value)
 /**
  * @brief The logic to convert a double into a string
  * @param value The value that we are converting
- * @return The resultant string
+ * @return The resultant string (six significant digits, the same as the stream default)
  */
 string StringUtils::Double2String(double value) 
 {
-    auto converter = stringstream();
-    converter << value;
-    return converter.str();
+    char buffer[32];
+    return string(buffer, FormatNumber(buffer, buffer + sizeof(buffer), value, 6));
+}
+
+//----------------------------------------------------------------------------------
+// TryParse
+//----------------------------------------------------------------------------------
+
+/**
+ * @brief Attempt to convert a string into an integer (without throwing)
+ * @param value The value that is being converted (surrounding whitespace and a leading + are allowed)
+ * @param output The resultant integer
+ * @return true The whole value was a valid integer
+ * @return false The conversion failed (output is left unchanged)
+ */
+bool StringUtils::TryParse(string_view value, int& output)
+{
+    return ParseNumber(value, output);
+}
+
+/**
+ * @brief Attempt to convert a string into a double (without throwing)
+ * @param value The value that is being converted (surrounding whitespace and a leading + are allowed)
+ * @param output The resultant double
+ * @return true The whole value was a valid number
+ * @return false The conversion failed (output is left unchanged)
+ * @remark This is locale independent, so a '.' is always the decimal point
+ */
+bool StringUtils::TryParse(string_view value, double& output)
+{
+    return ParseNumber(value, output);
+}
+
+/**
+ * @brief The shared from_chars based conversion logic
+ * @param value The value that is being converted
+ * @param output The resultant number
+ * @return true The conversion succeeded
+ * @return false The conversion failed
+ */
+template <typename T> bool StringUtils::ParseNumber(string_view value, T& output)
+{
+    auto begin = value.data(); auto end = begin + value.size();
+
+    while (begin < end && isspace((unsigned char)*begin)) begin++;
+    while (end > begin && isspace((unsigned char)end[-1])) end--;
+    if (begin < end && *begin == '+') begin++;
+
+    auto result = T(); auto status = from_chars(begin, end, result);
+    if (status.ec != errc() || status.ptr != end || begin == end) return false;
+
+    output = result; return true;
+}
+
+//----------------------------------------------------------------------------------
+// ParseNumbers
+//----------------------------------------------------------------------------------
+
+/**
+ * @brief Parse a delimited list of numbers into a caller owned buffer
+ * @param value The text that we are parsing
+ * @param output The buffer that we are filling
+ * @param capacity The number of entries within the buffer
+ * @param delimiter The delimiter between numbers (a space means any run of whitespace)
+ * @return int The number of values parsed, or -1 if a value was invalid or there were more than capacity values
+ */
+int StringUtils::ParseNumbers(string_view value, double * output, int capacity, char delimiter)
+{
+    return ParseList(value, output, capacity, delimiter);
+}
+
+/**
+ * @brief Parse a delimited list of integers into a caller owned buffer
+ * @param value The text that we are parsing
+ * @param output The buffer that we are filling
+ * @param capacity The number of entries within the buffer
+ * @param delimiter The delimiter between numbers (a space means any run of whitespace)
+ * @return int The number of values parsed, or -1 if a value was invalid or there were more than capacity values
+ */
+int StringUtils::ParseNumbers(string_view value, int * output, int capacity, char delimiter)
+{
+    return ParseList(value, output, capacity, delimiter);
+}
+
+/**
+ * @brief The shared list parsing logic
+ * @param value The text that we are parsing
+ * @param output The buffer that we are filling
+ * @param capacity The number of entries within the buffer
+ * @param delimiter The delimiter between numbers
+ * @return int The number of values parsed (-1 on failure)
+ */
+template <typename T> int StringUtils::ParseList(string_view value, T * output, int capacity, char delimiter)
+{
+    auto tokenizer = delimiter == ' ' ? StringTokenizer::Whitespace(value) : StringTokenizer(value, delimiter);
+
+    auto count = 0; auto token = string_view();
+    while (tokenizer.Next(token))
+    {
+        if (count >= capacity || !ParseNumber(token, output[count])) return -1;
+        count++;
+    }
+
+    return count;
+}
+
+//----------------------------------------------------------------------------------
+// FormatNumber
+//----------------------------------------------------------------------------------
+
+/**
+ * @brief Write an integer into a caller owned buffer
+ * @param begin The start of the buffer
+ * @param end The end of the buffer
+ * @param value The value that we are writing
+ * @return char * The position after the value (nullptr if the buffer was too small)
+ */
+char * StringUtils::FormatNumber(char * begin, char * end, int value)
+{
+    auto result = to_chars(begin, end, value);
+    return result.ec == errc() ? result.ptr : nullptr;
+}
+
+/**
+ * @brief Write a double into a caller owned buffer
+ * @param begin The start of the buffer
+ * @param end The end of the buffer
+ * @param value The value that we are writing
+ * @param precision The number of significant digits (-1 for the shortest text that reads back to the same value)
+ * @return char * The position after the value (nullptr if the buffer was too small)
+ */
+char * StringUtils::FormatNumber(char * begin, char * end, double value, int precision)
+{
+    auto result = precision < 0 ? to_chars(begin, end, value) : to_chars(begin, end, value, chars_format::general, precision);
+    return result.ec == errc() ? result.ptr : nullptr;
 }
 
 //----------------------------------------------------------------------------------
@@ -600,7 +758,7 @@ string StringUtils::Indent(int tabCount)
  * @param value The value that we are checking
  * @return True indicates the value is numeric, otherwise the system returns false
  */
-bool StringUtils::IsNumeric(const string& value) 
+bool StringUtils::IsNumeric(string_view value) 
 {
     auto it = value.begin();
     while (it != value.end() && std::isdigit(*it)) ++it;
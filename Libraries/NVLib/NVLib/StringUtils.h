@@ -13,9 +13,12 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <charconv>
+#include <string_view>
 using namespace std;
 
 #include "DateTimeUtils.h"
+#include "StringTokenizer.h"
 
 namespace NVLib
 {
@@ -23,6 +26,9 @@ namespace NVLib
 	{
 	public:
 		static void Split(const string & value, char delimiter, vector<string> & output);
+		static int Split(string_view value, char delimiter, vector<string_view> & output);
+		static int Split(string_view value, string_view delimiter, vector<string_view> & output);
+		static int SplitWhitespace(string_view value, vector<string_view> & output);
 		static void Trim(const string & value, string & output);
 		static int Replace(string& value, const string& token, const string& newToken);
 		static string ZeroBufferInt(int value, int bufferSize);
@@ -30,10 +36,16 @@ namespace NVLib
 		static string GetTimeString();
 		static string GetDateTimeString();
 		static string GetDateString();
-		static int String2Int(const string& value);
-		static double String2Double(const string& value);
+		static int String2Int(string_view value);
+		static double String2Double(string_view value);
 		static string Int2String(int value);
 		static string Double2String(double value);
+		static bool TryParse(string_view value, int& output);
+		static bool TryParse(string_view value, double& output);
+		static int ParseNumbers(string_view value, double * output, int capacity, char delimiter = ',');
+		static int ParseNumbers(string_view value, int * output, int capacity, char delimiter = ',');
+		static char * FormatNumber(char * begin, char * end, int value);
+		static char * FormatNumber(char * begin, char * end, double value, int precision = -1);
 		static string ToUpper(const string& value);
 		static bool StartsWith(const string& value, const string& token);
 		static bool EndsWith(const string& value, const string& token);
@@ -50,6 +62,9 @@ namespace NVLib
 		static string BuildFieldName(const string& field);
 		static void FieldSplit(const string & value, vector<string>&parts);
 		static string Indent(int tabCount);
-		static bool IsNumeric(const string& value);
+		static bool IsNumeric(string_view value);
+	private:
+		template <typename T> static bool ParseNumber(string_view value, T& output);
+		template <typename T> static int ParseList(string_view value, T * output, int capacity, char delimiter);
 	};
 }
@@ -45,6 +45,8 @@ namespace NVL_Utils
             parameters->Add("database", parser.get<String>("database"));
             parameters->Add("dataset", parser.get<String>("dataset"));
             parameters->Add("file_id", parser.get<String>("file_id"));
+            parameters->Add("profile", parser.get<String>("profile"));
+            parameters->Add("metrics", parser.get<String>("metrics"));
 
             return parameters;
         }        
@@ -116,7 +118,9 @@ namespace NVL_Utils
                 "{ help h usage ? |                       | Show help message                               }"
                 "{ database         | /home/trevor/Data/  | The folder containing the input files           }"
                 "{ dataset          | tree_0019a          | The folder containing the output files          }"
-                "{ file_id          | 3                   | The number of files that we are loading          }"; 
+                "{ file_id          | 3                   | The number of files that we are loading          }"
+                "{ profile          |                     | The path prefix for profiling output (empty = off) }"
+                "{ metrics          |                     | The path of the metrics snapshot file (empty = off) }"; 
 
             return string(keys);
         }
@@ -10,6 +10,8 @@
 using namespace std;
 
 #include <NVLib/Logger.h>
+#include <NVLib/Profiler.h>
+#include <NVLib/Metrics.h>
 #include <NVLib/Math3D.h>
 #include <NVLib/SaveUtils.h>
 #include <NVLib/PoseUtils.h>
@@ -46,43 +48,63 @@ void Run(NVLib::Parameters * parameters)
     if (parameters == nullptr) return; auto logger = NVLib::Logger(1);
 
     logger.StartApplication();
+
+    auto profilePath = NVL_Utils::ArgReader::ReadString(parameters, "profile");
+    NVLib::Profiler::SetEnabled(profilePath != string());
+
+    auto metricsPath = NVL_Utils::ArgReader::ReadString(parameters, "metrics");
+    if (metricsPath != string()) NVLib::Metrics::StartSnapshots(metricsPath, 5);
     
-    logger.Log(1, "Determining path locations");
+    NVLIB_LOG(logger, 1, "Determining path locations");
     auto pathHelper = NVL_App::PathHelper(parameters);
     auto frameFolder = pathHelper.GetFrameFolder();
     auto metaFolder = pathHelper.GetMetaFolder();
     auto modelFolder = pathHelper.GetModelFolder();
     auto poseFolder = pathHelper.GetPoseFolder();
 
-    logger.Log(1, "Determining the camera matrix");
+    NVLIB_LOG(logger, 1, "Determining the camera matrix");
     Mat camera = LoadCameraMatrix(metaFolder);
-    logger.Log(1, "Focal length: %f", ((double *) camera.data)[0]);
+    NVLIB_LOG(logger, 1, "Focal length: %f", ((double *) camera.data)[0]);
 
-    logger.Log(1, "Determining the index of the file to process");
+    NVLIB_LOG(logger, 1, "Determining the index of the file to process");
     auto fileId = NVL_Utils::ArgReader::ReadInteger(parameters, "file_id");
 
-    logger.Log(1, "Create a model folder if there is none");
+    NVLIB_LOG(logger, 1, "Create a model folder if there is none");
     if (NVLib::FileUtils::Exists(modelFolder)) NVLib::FileUtils::RemoveAll(modelFolder);
     NVLib::FileUtils::AddFolder(modelFolder);
 
-    logger.Log(1, "Processing Frame: %i", fileId);
+    NVLIB_LOG(logger, 1, "Processing Frame: %i", fileId);
 
-    logger.Log(1, "Loading the world pose");
+    NVLIB_LOG(logger, 1, "Loading the world pose");
     Mat worldPose = LoadPose(poseFolder, -1);
     if (worldPose.empty()) 
     {
-        logger.Log(1, "No world pose found! Assuming identity matrix");
+        NVLIB_LOG(logger, 1, "No world pose found! Assuming identity matrix");
         worldPose = Mat_<double>::eye(4,4);
     }
 
-    logger.Log(1, "Loading frame pose");
+    NVLIB_LOG(logger, 1, "Loading frame pose");
     Mat pose = LoadPose(poseFolder, fileId);
     if (pose.empty()) throw runtime_error("Pose not found for this frame");
     pose = worldPose * pose;
 
     auto frame = LoadFrame(frameFolder, fileId);
+    NVLib::Metrics::GetCounter("cloudgen_frames_processed").Add();
     SaveModel(modelFolder, camera, pose, frame.get());
 
+    if (metricsPath != string()) 
+    {
+        NVLib::Metrics::StopSnapshots();
+        NVLib::Metrics::Save(metricsPath);
+    }
+
+    if (profilePath != string()) 
+    {
+        NVLIB_LOG(logger, 1, "Saving the profile: %s", profilePath.c_str());
+        NVLib::Profiler::SaveTrace(profilePath + "_trace.json");
+        NVLib::Profiler::SaveSummary(profilePath + "_summary.csv");
+    }
+
     logger.StopApplication();
 }
 
@@ -97,6 +119,8 @@ void Run(NVLib::Parameters * parameters)
  */
 Mat LoadCameraMatrix(const string& folder) 
 {
+    NVLIB_PROFILE_SCOPE("CloudGen::LoadCameraMatrix");
+
     // The path to the calibration file
     auto path = NVLib::FileUtils::PathCombine(folder, "calibration.xml");
 
@@ -122,6 +146,8 @@ Mat LoadCameraMatrix(const string& folder)
  */
 Mat LoadPose(const string& folder, int index) 
 {
+    NVLIB_PROFILE_SCOPE("CloudGen::LoadPose");
+
     // Create the file name
     auto filename = stringstream(); 
     
@@ -160,6 +186,8 @@ Mat LoadPose(const string& folder, int index)
  */
 unique_ptr<NVL_App::Frame> LoadFrame(const string& folder, int index)
 {
+    NVLIB_PROFILE_SCOPE("CloudGen::LoadFrame");
+
 	// Generate the file names
 	auto colorFile = stringstream(); colorFile << "color_" << setw(4) << setfill('0') << index << ".png";
 	auto depthFile = stringstream(); depthFile << "depth_" << setw(4) << setfill('0') << index << ".tiff";
@@ -169,6 +197,7 @@ unique_ptr<NVL_App::Frame> LoadFrame(const string& folder, int index)
 	auto depthPath = NVLib::FileUtils::PathCombine(folder, depthFile.str());
 	
 	// Load the files
+	static auto& latency = NVLib::Metrics::GetHistogram("cloudgen_frame_read_ns"); NVLib::MetricTimer timer(latency);
 	Mat color = imread(colorPath); if (color.empty()) throw runtime_error("Unable to load: " + colorPath);
 	Mat depth = imread(depthPath, IMREAD_UNCHANGED); if (depth.empty()) throw runtime_error("Unable to load: " + depthPath);
 
@@ -189,6 +218,8 @@ unique_ptr<NVL_App::Frame> LoadFrame(const string& folder, int index)
  */
 void SaveModel(const string& folder, Mat& camera, Mat& pose, NVL_App::Frame * frame) 
 {
+    NVLIB_PROFILE_SCOPE("CloudGen::SaveModel");
+
     // Create the associated links
     auto dlink = (float *) frame->GetDepth().data;
 
@@ -200,7 +231,7 @@ void SaveModel(const string& folder, Mat& camera, Mat& pose, NVL_App::Frame * fr
     auto size = frame->GetColor().size();
 
     // Create a model to hold the result
-    auto model = NVLib::Model();
+    auto model = NVLib::Model(); auto invalidCount = 0;
 
     // Add the points to the model
     for (auto row = 0; row < size.height; row++) 
@@ -209,7 +240,7 @@ void SaveModel(const string& folder, Mat& camera, Mat& pose, NVL_App::Frame * fr
         {
             auto index = column + row * size.width;
 
-            auto Z = dlink[index]; if (Z <= 0 || Z > 1) continue;
+            auto Z = dlink[index]; if (Z <= 0 || Z > 1) { invalidCount++; continue; }
 
             auto scenePoint = NVLib::Math3D::UnProject(camera, Point2d(column, row), Z);
             auto tscenePoint = NVLib::Math3D::TransformPoint(pose, scenePoint);
@@ -222,6 +253,11 @@ void SaveModel(const string& folder, Mat& camera, Mat& pose, NVL_App::Frame * fr
         }
     }
 
+    // Record what the frame produced
+    static auto& pointCounter = NVLib::Metrics::GetCounter("cloudgen_points_emitted");
+    static auto& invalidCounter = NVLib::Metrics::GetCounter("cloudgen_invalid_depth_pixels");
+    pointCounter.Add(size.width * size.height - invalidCount); invalidCounter.Add(invalidCount);
+
     // Save the model
     NVLib::SaveUtils::SaveModel(path, &model);
 }
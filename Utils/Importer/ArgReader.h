@@ -45,6 +45,8 @@ namespace NVL_Utils
             parameters->Add("database", parser.get<String>("database"));
             parameters->Add("mfolder", parser.get<String>("mfolder"));
             parameters->Add("file_count", parser.get<String>("file_count"));
+            parameters->Add("profile", parser.get<String>("profile"));
+            parameters->Add("metrics", parser.get<String>("metrics"));
 
             return parameters;
         }        
@@ -116,7 +118,9 @@ namespace NVL_Utils
                 "{ help h usage ? |                       | Show help message                            }"
                 "{ database       | /home/trevor/Data     | The folder containing the input files        }"
                 "{ mfolder        | tree_0019b            | The Maaratech folder that we are processing  }"
-                "{ file_count     | 45                    | The location of the output folder            }"; 
+                "{ file_count     | 45                    | The location of the output folder            }"
+                "{ profile        |                       | The path prefix for profiling output (empty = off) }"
+                "{ metrics        |                       | The path of the metrics snapshot file (empty = off) }"; 
 
             return string(keys);
         }
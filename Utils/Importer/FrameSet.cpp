@@ -180,13 +180,14 @@ int FrameSet::InitFrameCount(const string& folder)
 
 	// Create a variable to hold the count
 	auto counter = 0; _startIndex = INT_MAX;	
+	auto parts = vector<string_view>();
 
 	// Count the number of "image" files
 	for (auto& fileName : fileNames) 
 	{
 		auto justFile = NVLib::FileUtils::GetFileName(fileName);
-		auto parts = vector<string>(); NVLib::StringUtils::Split(justFile, '_', parts);
-		if (parts[1] == "image" && parts[2] == "color.png") 
+		NVLib::StringUtils::Split(justFile, '_', parts);
+		if (parts.size() == 3 && parts[1] == "image" && parts[2] == "color.png") 
 		{
 			if (!NVLib::StringUtils::IsNumeric(parts[0])) continue;
 
@@ -15,6 +15,8 @@ using namespace std;
 using namespace cv;
 
 #include <NVLib/Logger.h>
+#include <NVLib/Profiler.h>
+#include <NVLib/Metrics.h>
 #include <NVLib/FileUtils.h>
 
 #include "ArgReader.h"
@@ -46,30 +48,48 @@ void Run(NVLib::Parameters * parameters)
 
     logger.StartApplication();
 
-    logger.Log(1, "Load in the input parameters");
+    auto profilePath = NVL_Utils::ArgReader::ReadString(parameters, "profile");
+    NVLib::Profiler::SetEnabled(profilePath != string());
+
+    auto metricsPath = NVL_Utils::ArgReader::ReadString(parameters, "metrics");
+    if (metricsPath != string()) NVLib::Metrics::StartSnapshots(metricsPath, 5);
+
+    NVLIB_LOG(logger, 1, "Load in the input parameters");
     auto database = NVL_Utils::ArgReader::ReadString(parameters, "database");
     auto folder = NVL_Utils::ArgReader::ReadString(parameters, "mfolder");
     auto count = NVL_Utils::ArgReader::ReadInteger(parameters, "file_count");
 
-    logger.Log(1, "Generating the folder locations");
+    NVLIB_LOG(logger, 1, "Generating the folder locations");
     auto outputFolder = CreateFolders(database, folder);
 
-    logger.Log(1, "Creating a frameset element");
+    NVLIB_LOG(logger, 1, "Creating a frameset element");
     auto inputFolder = BuildInputPath(database, folder);
     auto frameset = NVL_App::FrameSet(inputFolder);
 
-    logger.Log(1, "Preparing to perform loop thru frames");
+    NVLIB_LOG(logger, 1, "Preparing to perform loop thru frames");
     auto firstFrame = true;
 
-    logger.Log(1, "Processing Frames");
+    auto& frameCounter = NVLib::Metrics::GetCounter("importer_frames_processed");
+    auto& missingCounter = NVLib::Metrics::GetCounter("importer_frames_missing");
+    auto& readLatency = NVLib::Metrics::GetHistogram("importer_frame_read_ns");
+    auto& writeLatency = NVLib::Metrics::GetHistogram("importer_frame_write_ns");
+
+    NVLIB_LOG(logger, 1, "Processing Frames");
     for (auto i = 0; i < count; i++) 
     {
-        logger.Log(1, "Processing Frame: %i", i);
+        NVLIB_PROFILE_SCOPE("Importer::Frame");
+        NVLIB_LOG(logger, 1, "Processing Frame: %i", i);
+
+        auto frame = (NVL_App::Frame *) nullptr;
+        {
+            NVLib::MetricTimer timer(readLatency);
+            frame = frameset.GetNext();
+        }
 
-        auto frame = frameset.GetNext();
         if (frame == nullptr) 
         {
-            logger.Log(1, "Frame missing: %i", i);
+            NVLIB_LOG(logger, 1, "Frame missing: %i", i);
+            missingCounter.Add();
             continue;
         }
 
@@ -79,14 +99,32 @@ void Run(NVLib::Parameters * parameters)
             firstFrame = false;
         }
         
-        SaveFrame(outputFolder, frame);
-        SavePose(outputFolder, frame);
+        {
+            NVLib::MetricTimer timer(writeLatency);
+            SaveFrame(outputFolder, frame);
+            SavePose(outputFolder, frame);
+        }
+
+        frameCounter.Add();
     }
 
-    logger.Log(1, "Saving the world transform");
+    NVLIB_LOG(logger, 1, "Saving the world transform");
     Mat worldPose = frameset.GetPose(-1);
     SaveWorldPose(outputFolder, worldPose);
 
+    if (metricsPath != string()) 
+    {
+        NVLib::Metrics::StopSnapshots();
+        NVLib::Metrics::Save(metricsPath);
+    }
+
+    if (profilePath != string()) 
+    {
+        NVLIB_LOG(logger, 1, "Saving the profile: %s", profilePath.c_str());
+        NVLib::Profiler::SaveTrace(profilePath + "_trace.json");
+        NVLib::Profiler::SaveSummary(profilePath + "_summary.csv");
+    }
+
     logger.StopApplication();
 }
 
@@ -162,6 +200,8 @@ void SaveCameraMatrix(const string& folder, Mat& camera)
  */
 void SaveFrame(const string& folder, NVL_App::Frame * frame) 
 {
+    NVLIB_PROFILE_SCOPE("Importer::SaveFrame");
+
     // Defines the folder that we are saving to
     auto rawFolder = NVLib::FileUtils::PathCombine(folder, "raw");
 
@@ -184,6 +224,8 @@ void SaveFrame(const string& folder, NVL_App::Frame * frame)
  */
 void SavePose(const string & folder, NVL_App::Frame * frame) 
 {
+    NVLIB_PROFILE_SCOPE("Importer::SavePose");
+
     // Defines the path that I am saving to
     auto poseFolder = NVLib::FileUtils::PathCombine(folder, "pose");
     auto fileName = stringstream(); fileName << "pose_" << setw(4) << setfill('0') << frame->GetIndex() << ".xml";
@@ -0,0 +1,140 @@
+//--------------------------------------------------
+// Implementation of class KernelCheck
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "KernelCheck.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Constructors
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param repeats The number of timed runs of each kernel (the median is reported)
+ */
+KernelCheck::KernelCheck(int repeats) : _repeats(repeats), _checks(0)
+{
+	if (repeats <= 0) throw runtime_error("At least one timed run is required");
+}
+
+//--------------------------------------------------
+// Checks
+//--------------------------------------------------
+
+/**
+ * @brief Check that two matrices are bit-for-bit identical
+ * @param name The name of the check
+ * @param expected The output of the reference implementation
+ * @param actual The output of the implementation being verified
+ */
+void KernelCheck::Compare(const string& name, const Mat& expected, const Mat& actual)
+{
+	Verify(name, IsIdentical(expected, actual));
+}
+
+/**
+ * @brief Check that two values agree
+ * @param name The name of the check
+ * @param expected The value from the reference implementation
+ * @param actual The value from the implementation being verified
+ * @param tolerance The allowed absolute difference (NaN only matches NaN)
+ */
+void KernelCheck::Compare(const string& name, double expected, double actual, double tolerance)
+{
+	auto passed = std::isnan(expected) ? std::isnan(actual) : std::abs(expected - actual) <= tolerance;
+	if (!passed) cout << "  expected " << setprecision(17) << expected << ", got " << actual << endl;
+	Verify(name, passed);
+}
+
+/**
+ * @brief Record the outcome of a check
+ * @param name The name of the check
+ * @param passed Indicates whether the check passed
+ */
+void KernelCheck::Verify(const string& name, bool passed)
+{
+	_checks++;
+	if (passed) return;
+
+	_failures.push_back(name);
+	cout << "FAILED: " << name << endl;
+}
+
+//--------------------------------------------------
+// Timing
+//--------------------------------------------------
+
+/**
+ * @brief Time a task (after a warm-up run)
+ * @param task The task that we are timing
+ * @return double The median time in milliseconds
+ */
+double KernelCheck::Time(const function<void()>& task)
+{
+	task();
+
+	auto times = vector<double>();
+
+	for (auto i = 0; i < _repeats; i++)
+	{
+		auto ticks = getTickCount(); task();
+		times.push_back(1000.0 * (getTickCount() - ticks) / getTickFrequency());
+	}
+
+	nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+	return times[times.size() / 2];
+}
+
+/**
+ * @brief Time a reference and a new implementation and print the speed-up
+ * @param name The name of the kernel
+ * @param reference The reference (previous) implementation
+ * @param task The new implementation
+ */
+void KernelCheck::Report(const string& name, const function<void()>& reference, const function<void()>& task)
+{
+	auto referenceTime = Time(reference); auto taskTime = Time(task);
+	auto speedup = taskTime > 0 ? referenceTime / taskTime : 0;
+
+	cout << left << setw(28) << name << right << fixed << setprecision(3);
+	cout << setw(12) << referenceTime << " ms" << setw(12) << taskTime << " ms" << setw(10) << setprecision(2) << speedup << "x" << endl;
+	cout.unsetf(ios::floatfield);
+}
+
+/**
+ * @brief Print the outcome of all the checks
+ */
+void KernelCheck::PrintSummary()
+{
+	cout << endl << (_checks - (int)_failures.size()) << " of " << _checks << " checks passed" << endl;
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Determine whether two matrices have the same size, type and bytes
+ * @param expected The first matrix
+ * @param actual The second matrix
+ * @return true The matrices are identical
+ * @return false The matrices differ
+ */
+bool KernelCheck::IsIdentical(const Mat& expected, const Mat& actual)
+{
+	if (expected.size() != actual.size() || expected.type() != actual.type()) return false;
+
+	auto rowSize = expected.cols * expected.elemSize();
+
+	for (auto row = 0; row < expected.rows; row++)
+	{
+		if (memcmp(expected.ptr(row), actual.ptr(row), rowSize) != 0) return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,48 @@
+//--------------------------------------------------
+// Collects the equivalence checks and timings of a kernel verification run
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <functional>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVL_App
+{
+	class KernelCheck
+	{
+	private:
+		int _repeats;
+		int _checks;
+		vector<string> _failures;
+	public:
+		KernelCheck(int repeats);
+
+		void Compare(const string& name, const Mat& expected, const Mat& actual);
+		void Compare(const string& name, double expected, double actual, double tolerance = 0);
+		void Verify(const string& name, bool passed);
+
+		double Time(const function<void()>& task);
+		void Report(const string& name, const function<void()>& reference, const function<void()>& task);
+
+		void PrintSummary();
+
+		inline int GetCheckCount() { return _checks; }
+		inline vector<string>& GetFailures() { return _failures; }
+	private:
+		static bool IsIdentical(const Mat& expected, const Mat& actual);
+	};
+}
@@ -0,0 +1,132 @@
+//--------------------------------------------------
+// Implementation of class MaskSuite
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "MaskSuite.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Run
+//--------------------------------------------------
+
+/**
+ * @brief Check the kernels on continuous and ROI inputs, and then time them against the previous loops
+ * @param check The collector of the results
+ * @param size The size of the test images
+ * @param seed The seed used to generate the inputs
+ */
+void MaskSuite::Run(KernelCheck& check, const Size& size, unsigned int seed)
+{
+	auto rng = RNG(seed); auto padded = Size(size.width + 16, size.height + 12);
+
+	// Small color values so that exact color matches are common
+	Mat color = Mat(padded, CV_8UC3); rng.fill(color, RNG::UNIFORM, 0, 4);
+
+	// Masks include values other than 255, since any non-zero value counts as set
+	Mat mask = Mat(padded, CV_8UC1); rng.fill(mask, RNG::UNIFORM, 0, 3); mask *= 127;
+
+	Mat magnitude = Mat(padded, CV_32FC3); rng.fill(magnitude, RNG::UNIFORM, 0.0f, 10.0f);
+	Mat direction = Mat(padded, CV_32FC3); rng.fill(direction, RNG::UNIFORM, 0.0f, 360.0f);
+
+	// Continuous inputs
+	Mat color_1 = GetRegion(color, size, false), mask_1 = GetRegion(mask, size, false);
+	Mat magnitude_1 = GetRegion(magnitude, size, false), direction_1 = GetRegion(direction, size, false);
+	CheckKernels(check, "continuous", color_1, mask_1, magnitude_1, direction_1);
+
+	// ROI views (not continuous, and not starting at the origin of the data)
+	Mat color_2 = GetRegion(color, size, true), mask_2 = GetRegion(mask, size, true);
+	Mat magnitude_2 = GetRegion(magnitude, size, true), direction_2 = GetRegion(direction, size, true);
+	check.Verify("mask/roi inputs are not continuous", !color_2.isContinuous() && !mask_2.isContinuous());
+	CheckKernels(check, "roi", color_2, mask_2, magnitude_2, direction_2);
+
+	TimeKernels(check, color_1, mask_1, magnitude_1, direction_1);
+}
+
+//--------------------------------------------------
+// Checks
+//--------------------------------------------------
+
+/**
+ * @brief Compare each kernel with the previous loop
+ * @param check The collector of the results
+ * @param label The label of the input layout
+ * @param color A color image (CV_8UC3)
+ * @param mask A mask (CV_8UC1)
+ * @param magnitude Color gradient magnitudes (CV_32FC3)
+ * @param direction Color gradient directions (CV_32FC3)
+ * @remark The previous loops only handle continuous data, so they are given a continuous copy of each input
+ */
+void MaskSuite::CheckKernels(KernelCheck& check, const string& label, Mat& color, Mat& mask, Mat& magnitude, Mat& direction)
+{
+	Mat refColor = color.clone(), refMask = mask.clone(), refMagnitude = magnitude.clone(), refDirection = direction.clone();
+	auto name = [&label](const string& kernel) { return "mask/" + label + "/" + kernel; };
+
+	auto match = Vec3i(1, 2, 3); auto blend = Vec3i(200, 17, 90);
+
+	check.Compare(name("InvertMask"), ReferenceKernels::InvertMask(refMask), NVLib::ImageUtils::InvertMask(mask));
+	check.Compare(name("GetColorBinary"), ReferenceKernels::GetColorBinary(refColor, match), NVLib::ImageUtils::GetColorBinary(color, match));
+	check.Compare(name("GetMaskImage"), ReferenceKernels::GetMaskImage(refColor, refMask, blend), NVLib::ImageUtils::GetMaskImage(color, mask, blend));
+	check.Compare(name("GetColorGradient"), ReferenceKernels::GetColorGradient(refMagnitude, refDirection), NVLib::ImageUtils::GetColorGradient(magnitude, direction));
+
+	// Integer, fractional and out of range colors
+	for (auto& scalar : { Scalar(1, 2, 3), Scalar(1.5, 2, 3), Scalar(300, 2, 3) })
+	{
+		check.Compare(name("GetPixelCount"), ReferenceKernels::GetPixelCount(refColor, scalar), NVLib::ImageUtils::GetPixelCount(color, scalar));
+	}
+
+	Mat grayMask = mask; check.Compare(name("GetPixelCount/gray"), ReferenceKernels::GetPixelCount(refMask, Scalar(127)), NVLib::ImageUtils::GetPixelCount(grayMask, Scalar(127)));
+
+	// Fractional channels are truncated (the same as assigning the scalar into the image)
+	for (auto& scalar : { Scalar(255, 0, 128), Scalar(10.7, 200.2, 99.9) })
+	{
+		check.Compare(name("OverlayMask"), ReferenceKernels::OverlayMask(refColor, refMask, scalar), NVLib::DrawUtils::OverlayMask(color, mask, scalar));
+	}
+
+	check.Compare(name("ExtractMask"), ReferenceKernels::ExtractMask(refColor, refMask), NVLib::DrawUtils::ExtractMask(color, mask));
+}
+
+//--------------------------------------------------
+// Timing
+//--------------------------------------------------
+
+/**
+ * @brief Time each kernel against the previous loop
+ * @param check The collector of the results
+ * @param color A color image (CV_8UC3)
+ * @param mask A mask (CV_8UC1)
+ * @param magnitude Color gradient magnitudes (CV_32FC3)
+ * @param direction Color gradient directions (CV_32FC3)
+ */
+void MaskSuite::TimeKernels(KernelCheck& check, Mat& color, Mat& mask, Mat& magnitude, Mat& direction)
+{
+	auto match = Vec3i(1, 2, 3); auto blend = Vec3i(200, 17, 90); auto scalar = Scalar(255, 0, 128);
+
+	check.Report("InvertMask", [&]() { ReferenceKernels::InvertMask(mask); }, [&]() { NVLib::ImageUtils::InvertMask(mask); });
+	check.Report("GetColorBinary", [&]() { ReferenceKernels::GetColorBinary(color, match); }, [&]() { NVLib::ImageUtils::GetColorBinary(color, match); });
+	check.Report("GetMaskImage", [&]() { ReferenceKernels::GetMaskImage(color, mask, blend); }, [&]() { NVLib::ImageUtils::GetMaskImage(color, mask, blend); });
+	check.Report("GetColorGradient", [&]() { ReferenceKernels::GetColorGradient(magnitude, direction); }, [&]() { NVLib::ImageUtils::GetColorGradient(magnitude, direction); });
+	check.Report("GetPixelCount", [&]() { ReferenceKernels::GetPixelCount(color, scalar); }, [&]() { NVLib::ImageUtils::GetPixelCount(color, scalar); });
+	check.Report("OverlayMask", [&]() { ReferenceKernels::OverlayMask(color, mask, scalar); }, [&]() { NVLib::DrawUtils::OverlayMask(color, mask, scalar); });
+	check.Report("ExtractMask", [&]() { ReferenceKernels::ExtractMask(color, mask); }, [&]() { NVLib::DrawUtils::ExtractMask(color, mask); });
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve a test region from a padded image
+ * @param full The padded image
+ * @param size The size of the region
+ * @param offset Indicates whether an offset ROI view is returned (otherwise a continuous copy from the origin)
+ * @return Mat The resultant region
+ */
+Mat MaskSuite::GetRegion(Mat& full, const Size& size, bool offset)
+{
+	if (offset) return full(Rect(Point(8, 6), size));
+	return full(Rect(Point(0, 0), size)).clone();
+}
@@ -0,0 +1,34 @@
+//--------------------------------------------------
+// Verifies the parallel mask kernels of ImageUtils and DrawUtils against the previous loops
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/ImageUtils.h>
+#include <NVLib/DrawUtils.h>
+
+#include "KernelCheck.h"
+#include "ReferenceKernels.h"
+
+namespace NVL_App
+{
+	class MaskSuite
+	{
+	public:
+		static void Run(KernelCheck& check, const Size& size, unsigned int seed);
+	private:
+		static void CheckKernels(KernelCheck& check, const string& label, Mat& color, Mat& mask, Mat& magnitude, Mat& direction);
+		static void TimeKernels(KernelCheck& check, Mat& color, Mat& mask, Mat& magnitude, Mat& direction);
+		static Mat GetRegion(Mat& full, const Size& size, bool offset);
+	};
+}
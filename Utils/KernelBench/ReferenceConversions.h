@@ -0,0 +1,70 @@
+//--------------------------------------------------
+// The previous (stringstream based) StringUtils numeric conversions, kept as a reference
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <sstream>
+#include <iostream>
+using namespace std;
+
+namespace NVL_App
+{
+	class ReferenceConversions
+	{
+	public:
+
+		/**
+		 * @brief The previous StringUtils::String2Int
+		 * @param value The value that is being converted
+		 * @return int The resultant integer
+		 */
+		inline static int String2Int(const string& value)
+		{
+			auto converter = stringstream(value);
+			int result; converter >> result;
+			if (converter.fail()) throw runtime_error("Integer conversion failed: " + value);
+			return result;
+		}
+
+		/**
+		 * @brief The previous StringUtils::String2Double
+		 * @param value The value that is being converted
+		 * @return double The resultant double
+		 */
+		inline static double String2Double(const string& value)
+		{
+			auto converter = stringstream(value);
+			double result; converter >> result;
+			return result;
+		}
+
+		/**
+		 * @brief The previous StringUtils::Int2String
+		 * @param value The value that is being converted
+		 * @return string The resultant string
+		 */
+		inline static string Int2String(int value)
+		{
+			auto converter = stringstream();
+			converter << value;
+			return converter.str();
+		}
+
+		/**
+		 * @brief The previous StringUtils::Double2String
+		 * @param value The value that is being converted
+		 * @return string The resultant string
+		 */
+		inline static string Double2String(double value)
+		{
+			auto converter = stringstream();
+			converter << value;
+			return converter.str();
+		}
+	};
+}
@@ -0,0 +1,226 @@
+//--------------------------------------------------
+// The previous (scalar, continuous-only) implementations of the mask kernels, kept as a reference
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVL_App
+{
+	class ReferenceKernels
+	{
+	public:
+
+		/**
+		 * @brief The previous ImageUtils::GetColorBinary
+		 * @param image The image that we are processing
+		 * @param color The color that we are looking for
+		 * @return Mat The resultant mask (255 where the color does not match)
+		 */
+		inline static Mat GetColorBinary(Mat& image, const Vec3i& color)
+		{
+			Mat mask = Mat_<uchar>::zeros(image.size());
+
+			for (auto row = 0; row < image.rows; row++)
+			{
+				for (auto column = 0; column < image.cols; column++)
+				{
+					auto index = column + row * image.cols;
+					auto c1 = image.data[index * 3 + 0];
+					auto c2 = image.data[index * 3 + 1];
+					auto c3 = image.data[index * 3 + 2];
+
+					if (c1 != color[0] || c2 != color[1] || c3 != color[2]) mask.data[index] = 255;
+					else mask.data[index] = 0;
+				}
+			}
+
+			return mask;
+		}
+
+		/**
+		 * @brief The previous ImageUtils::GetMaskImage
+		 * @param image The image that we are processing
+		 * @param mask The mask of the pixels that are blended
+		 * @param color The color that is blended in
+		 * @return Mat The resultant image
+		 */
+		inline static Mat GetMaskImage(Mat& image, Mat& mask, const Vec3i& color)
+		{
+			Mat result = image.clone();
+
+			for (auto row = 0; row < image.rows; row++)
+			{
+				for (auto column = 0; column < image.cols; column++)
+				{
+					auto index = column + row * image.cols;
+					if (mask.data[index] == 0) continue;
+
+					auto c1 = (double)image.data[index * 3 + 0];
+					auto c2 = (double)image.data[index * 3 + 1];
+					auto c3 = (double)image.data[index * 3 + 2];
+
+					result.data[index * 3 + 0] = saturate_cast<uchar>((c1 + color[0]) / 2.0);
+					result.data[index * 3 + 1] = saturate_cast<uchar>((c2 + color[1]) / 2.0);
+					result.data[index * 3 + 2] = saturate_cast<uchar>((c3 + color[2]) / 2.0);
+				}
+			}
+
+			return result;
+		}
+
+		/**
+		 * @brief The previous ImageUtils::GetColorGradient
+		 * @param magnitude The 3 channel magnitudes
+		 * @param direction The 3 channel directions
+		 * @return Mat The magnitude and direction of the strongest channel
+		 * @remark The previous loop kept the best values in ints, which truncated the output. That was a bug that the
+		 * new kernel fixes, so the reference keeps them as floats (everything else is unchanged).
+		 */
+		inline static Mat GetColorGradient(Mat& magnitude, Mat& direction)
+		{
+			auto mdata = (float *) magnitude.data; auto ddata = (float *) direction.data;
+
+			Mat result = Mat_<Vec2f>(magnitude.size());
+			auto output = (float *) result.data;
+
+			for (auto row = 0; row < result.rows; row++)
+			{
+				for (auto column = 0; column < result.cols; column++)
+				{
+					auto bestMagnitude = 0.0f; auto bestDirection = 0.0f;
+					auto baseIndex = column + row * result.cols;
+
+					for (auto channel = 0; channel < 3; channel++)
+					{
+						auto index = baseIndex * 3 + channel;
+						auto currentM = mdata[index];
+						auto currentD = ddata[index];
+						if (currentM > bestMagnitude) { bestMagnitude = currentM; bestDirection = currentD; }
+					}
+
+					output[baseIndex * 2 + 0] = bestMagnitude;
+					output[baseIndex * 2 + 1] = bestDirection;
+				}
+			}
+
+			return result;
+		}
+
+		/**
+		 * @brief The previous ImageUtils::InvertMask
+		 * @param maskImage The mask that we are inverting
+		 * @return Mat The inverted mask
+		 */
+		inline static Mat InvertMask(Mat& maskImage)
+		{
+			Mat result = Mat_<uchar>(maskImage.size());
+
+			for (auto row = 0; row < maskImage.rows; row++)
+			{
+				for (auto column = 0; column < maskImage.cols; column++)
+				{
+					auto index = column + row * maskImage.cols;
+					result.data[index] = maskImage.data[index] == 0 ? 255 : 0;
+				}
+			}
+
+			return result;
+		}
+
+		/**
+		 * @brief The previous ImageUtils::GetPixelCount(image, color)
+		 * @param image The image that we are counting in
+		 * @param color The color that we are counting
+		 * @return int The number of matching pixels
+		 */
+		inline static int GetPixelCount(Mat& image, const Scalar& color)
+		{
+			auto accumulator = 0; auto channels = image.channels();
+
+			for (auto row = 0; row < image.rows; row++)
+			{
+				for (auto column = 0; column < image.cols; column++)
+				{
+					auto index = column + row * image.cols;
+
+					bool match = true;
+					for (auto channel = 0; channel < channels; channel++)
+					{
+						auto imageColor = image.data[index * channels + channel];
+						auto expectedColor = color[channel];
+						match &= expectedColor == imageColor;
+					}
+
+					if (match) accumulator++;
+				}
+			}
+
+			return accumulator;
+		}
+
+		/**
+		 * @brief The previous DrawUtils::OverlayMask
+		 * @param image The image that we are drawing on
+		 * @param overlay The mask of the pixels that are painted
+		 * @param color The color that is painted
+		 * @return Mat The resultant image
+		 */
+		inline static Mat OverlayMask(Mat& image, Mat& overlay, const Scalar& color)
+		{
+			Mat result = image.clone();
+
+			for (auto row = 0; row < result.rows; row++)
+			{
+				for (auto column = 0; column < result.cols; column++)
+				{
+					auto index = column + row * result.cols;
+
+					if (overlay.data[index] != 0)
+					{
+						result.data[index * 3 + 0] = color[0];
+						result.data[index * 3 + 1] = color[1];
+						result.data[index * 3 + 2] = color[2];
+					}
+				}
+			}
+
+			return result;
+		}
+
+		/**
+		 * @brief The previous DrawUtils::ExtractMask
+		 * @param image The image that we are extracting from
+		 * @param mask The mask of the pixels that are kept
+		 * @return Mat The resultant image
+		 */
+		inline static Mat ExtractMask(Mat& image, Mat& mask)
+		{
+			Mat result = image.clone();
+
+			for (auto row = 0; row < image.rows; row++)
+			{
+				for (auto column = 0; column < image.cols; column++)
+				{
+					auto index = column + row * image.cols;
+					if (mask.data[index] != 0) continue;
+
+					result.data[index * 3 + 0] = 0;
+					result.data[index * 3 + 1] = 0;
+					result.data[index * 3 + 2] = 0;
+				}
+			}
+
+			return result;
+		}
+	};
+}
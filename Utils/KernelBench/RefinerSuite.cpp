@@ -0,0 +1,81 @@
+//--------------------------------------------------
+// Implementation of class RefinerSuite
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "RefinerSuite.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Run
+//--------------------------------------------------
+
+/**
+ * @brief Check the dual number jacobian of a circle fit, and that the fit recovers the circle
+ * @param check The collector of the results
+ * @param seed The seed used to generate the points
+ */
+void RefinerSuite::Run(KernelCheck& check, unsigned int seed)
+{
+	auto rng = RNG(seed); auto circle = Vec3d(12.5, -4.0, 7.25);
+	Mat points = GetCirclePoints(rng, circle, 200);
+
+	// The jacobian from the dual numbers should match a central difference of the double evaluation
+	auto problem = NVLib::CircleProblem(points);
+	Mat params = (Mat_<double>(3, 1) << 10.0, -2.0, 5.0);
+
+	auto jacobianMatch = true; auto valueMatch = true; const auto step = 1e-6;
+
+	for (auto item = 0; item < problem.GetTrainingSize(); item++)
+	{
+		double jacobian[3]; auto value = problem.GetErrorAndJacobian(params, item, jacobian);
+		valueMatch &= std::abs(value - problem.GetError(params, item)) <= 1e-12;
+
+		for (auto i = 0; i < 3; i++)
+		{
+			Mat plus = params.clone(); plus.at<double>(i) += step;
+			Mat minus = params.clone(); minus.at<double>(i) -= step;
+			auto expected = (problem.GetError(plus, item) - problem.GetError(minus, item)) / (2 * step);
+			jacobianMatch &= std::abs(jacobian[i] - expected) <= 1e-6;
+		}
+	}
+
+	check.Verify("refiner/CircleProblem/value", valueMatch);
+	check.Verify("refiner/CircleProblem/jacobian", jacobianMatch);
+
+	// A full solve through the engine (which takes ownership of the problem)
+	auto engine = NVLib::LMEngine(new NVLib::CircleProblem(points));
+	engine.Minimize(params, 100);
+
+	check.Compare("refiner/CircleProblem/fit/x", circle[0], params.at<double>(0), 1e-3);
+	check.Compare("refiner/CircleProblem/fit/y", circle[1], params.at<double>(1), 1e-3);
+	check.Compare("refiner/CircleProblem/fit/radius", circle[2], params.at<double>(2), 1e-3);
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Generate points on a circle (with a small amount of noise)
+ * @param rng The random number generator
+ * @param circle The circle (center x, center y, radius)
+ * @param count The number of points
+ * @return Mat The points (one per row)
+ */
+Mat RefinerSuite::GetCirclePoints(RNG& rng, const Vec3d& circle, int count)
+{
+	Mat result = Mat_<double>(count, 2);
+
+	for (auto i = 0; i < count; i++)
+	{
+		auto angle = rng.uniform(0.0, 2 * CV_PI); auto radius = circle[2] + rng.gaussian(1e-4);
+		result.at<double>(i, 0) = circle[0] + radius * std::cos(angle);
+		result.at<double>(i, 1) = circle[1] + radius * std::sin(angle);
+	}
+
+	return result;
+}
@@ -0,0 +1,32 @@
+//--------------------------------------------------
+// Verifies the auto-differentiated refiner path (CircleProblem) against finite differences
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/Refiner/CircleProblem.h>
+#include <NVLib/Refiner/LMEngine.h>
+
+#include "KernelCheck.h"
+
+namespace NVL_App
+{
+	class RefinerSuite
+	{
+	public:
+		static void Run(KernelCheck& check, unsigned int seed);
+	private:
+		static Mat GetCirclePoints(RNG& rng, const Vec3d& circle, int count);
+	};
+}
@@ -0,0 +1,203 @@
+//--------------------------------------------------
+// Implementation of class RegionSuite
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "RegionSuite.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Run
+//--------------------------------------------------
+
+/**
+ * @brief Check the region queries on masks and depth maps, and then time them against a brute force scan
+ * @param check The collector of the results
+ * @param size The size of the test images
+ * @param seed The seed used to generate the inputs
+ */
+void RegionSuite::Run(KernelCheck& check, const Size& size, unsigned int seed)
+{
+	auto rng = RNG(seed); auto padded = Size(size.width + 16, size.height + 12);
+	auto roi = Rect(Point(8, 6), size);
+
+	// A mask with values other than 255 (any non-zero value is set)
+	Mat mask = Mat(padded, CV_8UC1); rng.fill(mask, RNG::UNIFORM, 0, 3); mask *= 127;
+
+	// A 16-bit depth map with missing (zero) values
+	Mat depth16 = Mat(padded, CV_16UC1); rng.fill(depth16, RNG::UNIFORM, 0, 65536);
+	Mat holes = Mat(padded, CV_8UC1); rng.fill(holes, RNG::UNIFORM, 0, 4); depth16.setTo(0, holes == 0);
+
+	// A float depth map with both zero and NaN values
+	Mat depth32; depth16.convertTo(depth32, CV_32F, 0.001);
+	depth32.setTo(numeric_limits<float>::quiet_NaN(), holes == 1 & depth16 != 0);
+
+	auto regions = GetRegions(rng, size, 200);
+
+	for (auto image : { mask, depth16, depth32 })
+	{
+		auto label = image.depth() == CV_8U ? string("mask") : image.depth() == CV_16U ? string("depth16") : string("depth32");
+
+		Mat continuous = image(roi).clone(); CheckQueries(check, label + "/continuous", continuous, regions);
+		Mat view = image(roi); CheckQueries(check, label + "/roi", view, regions);
+	}
+
+	Mat maskView = mask(roi); CheckWindows(check, maskView);
+
+	Mat depthView = depth32(roi); TimeQueries(check, depthView, regions);
+}
+
+//--------------------------------------------------
+// Checks
+//--------------------------------------------------
+
+/**
+ * @brief Compare the cached queries with a brute force scan of each region
+ * @param check The collector of the results
+ * @param label The label of the input
+ * @param image The image that we are querying
+ * @param regions The regions that are queried (some cross or lie outside the border)
+ */
+void RegionSuite::CheckQueries(KernelCheck& check, const string& label, Mat& image, vector<Rect>& regions)
+{
+	auto stats = NVLib::RegionStats(image);
+	auto name = [&label](const string& query) { return "region/" + label + "/" + query; };
+
+	auto sums = true; auto counts = true; auto areas = true; auto means = true; auto validMeans = true; auto variances = true;
+
+	for (auto& region : regions)
+	{
+		auto expected = GetBruteForce(image, region);
+		auto area = (region & Rect(0, 0, image.cols, image.rows)).area();
+
+		// Summation order differs from the scan, so the results are compared with a relative tolerance
+		auto tolerance = 1e-9 * (expected[1] / std::max(area, 1) + 1);
+		auto mean = area == 0 ? 0.0 : expected[0] / area;
+		auto validMean = expected[2] == 0 ? 0.0 : expected[0] / expected[2];
+		auto variance = area == 0 ? 0.0 : std::max(0.0, expected[1] / area - mean * mean);
+
+		sums &= std::abs(stats.GetSum(region) - expected[0]) <= 1e-9 * (std::abs(expected[0]) + 1);
+		counts &= stats.GetCount(region) == (int)expected[2];
+		areas &= stats.GetArea(region) == area;
+		means &= std::abs(stats.GetMean(region) - mean) <= 1e-9 * (std::abs(mean) + 1);
+		validMeans &= std::abs(NVLib::ImageUtils::GetMeanDepth(stats, region) - validMean) <= 1e-9 * (std::abs(validMean) + 1);
+		variances &= std::abs(stats.GetVariance(region) - variance) <= tolerance;
+
+		counts &= NVLib::ImageUtils::GetPixelCount(stats, region) == (int)expected[2];
+	}
+
+	check.Verify(name("GetSum"), sums);
+	check.Verify(name("GetCount"), counts);
+	check.Verify(name("GetArea"), areas);
+	check.Verify(name("GetMean"), means);
+	check.Verify(name("GetValidMean"), validMeans);
+	check.Verify(name("GetVariance"), variances);
+
+	// The whole image, a single pixel at the far corner, and regions entirely outside the image
+	auto full = Rect(0, 0, image.cols, image.rows);
+	check.Compare(name("full/GetCount"), GetBruteForce(image, full)[2], stats.GetCount(full));
+	check.Compare(name("corner/GetCount"), GetBruteForce(image, Rect(image.cols - 1, image.rows - 1, 1, 1))[2], stats.GetCount(Rect(image.cols - 1, image.rows - 1, 5, 5)));
+	check.Compare(name("outside/GetCount"), 0, stats.GetCount(Rect(-20, -20, 10, 10)));
+	check.Compare(name("outside/GetValidMean"), 0, stats.GetValidMean(Rect(image.cols + 5, 0, 10, 10)));
+	check.Compare(name("GetCoverage"), GetBruteForce(image, full)[2] / full.area(), NVLib::RectangleUtils::GetCoverage(stats, full), 1e-12);
+}
+
+/**
+ * @brief Compare the densest window search with a brute force search
+ * @param check The collector of the results
+ * @param mask The mask that we are searching
+ */
+void RegionSuite::CheckWindows(KernelCheck& check, Mat& mask)
+{
+	auto stats = NVLib::RegionStats(mask); auto window = Size(std::max(1, mask.cols / 7), std::max(1, mask.rows / 5)); auto step = 3;
+
+	auto best = Rect(Point(0, 0), window); auto bestCount = -1.0;
+
+	for (auto row = 0; row <= mask.rows - window.height; row += step)
+	{
+		for (auto column = 0; column <= mask.cols - window.width; column += step)
+		{
+			auto candidate = Rect(Point(column, row), window);
+			auto count = GetBruteForce(mask, candidate)[2];
+			if (count > bestCount) { bestCount = count; best = candidate; }
+		}
+	}
+
+	check.Verify("region/FindDensestWindow", NVLib::RectangleUtils::FindDensestWindow(stats, window, step) == best);
+}
+
+//--------------------------------------------------
+// Timing
+//--------------------------------------------------
+
+/**
+ * @brief Time the region queries against a brute force scan (the cached timing includes building the tables)
+ * @param check The collector of the results
+ * @param depth The depth map that we are querying
+ * @param regions The regions that are queried
+ */
+void RegionSuite::TimeQueries(KernelCheck& check, Mat& depth, vector<Rect>& regions)
+{
+	auto sink = 0.0; auto stats = NVLib::RegionStats();
+
+	check.Report("GetValidMean x " + to_string(regions.size()),
+		[&]() { for (auto& region : regions) { auto value = GetBruteForce(depth, region); sink += value[2] == 0 ? 0 : value[0] / value[2]; } },
+		[&]() { stats.Build(depth); for (auto& region : regions) sink += stats.GetValidMean(region); });
+
+	if (sink == 0.12345) cout << endl;
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Scan a region pixel by pixel
+ * @param image The single channel image that we are scanning (8-bit, 16-bit or float)
+ * @param region The region (clipped to the image)
+ * @return Vec4d The sum, square sum and valid (non-zero, non-NaN) count of the region, and its area
+ */
+Vec4d RegionSuite::GetBruteForce(Mat& image, const Rect& region)
+{
+	auto clipped = region & Rect(0, 0, image.cols, image.rows); auto result = Vec4d(0, 0, 0, clipped.area());
+
+	for (auto row = clipped.y; row < clipped.y + clipped.height; row++)
+	{
+		for (auto column = clipped.x; column < clipped.x + clipped.width; column++)
+		{
+			auto value = 0.0;
+			if (image.depth() == CV_8U) value = image.at<uchar>(row, column);
+			else if (image.depth() == CV_16U) value = image.at<ushort>(row, column);
+			else value = image.at<float>(row, column);
+
+			if (value == 0 || std::isnan(value)) continue;
+			result[0] += value; result[1] += value * value; result[2]++;
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @brief Generate random regions, including ones that cross or lie beyond the image border
+ * @param rng The random number generator
+ * @param size The size of the image
+ * @param count The number of regions
+ * @return vector<Rect> The resultant regions
+ */
+vector<Rect> RegionSuite::GetRegions(RNG& rng, const Size& size, int count)
+{
+	auto result = vector<Rect>();
+
+	for (auto i = 0; i < count; i++)
+	{
+		auto x = rng.uniform(-size.width / 4, size.width + 4); auto y = rng.uniform(-size.height / 4, size.height + 4);
+		auto width = rng.uniform(0, size.width / 2 + 1); auto height = rng.uniform(0, size.height / 2 + 1);
+		result.push_back(Rect(x, y, width, height));
+	}
+
+	return result;
+}
@@ -0,0 +1,38 @@
+//--------------------------------------------------
+// Verifies the RegionStats rectangle queries against a brute force scan of each region
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/RegionStats.h>
+#include <NVLib/ImageUtils.h>
+#include <NVLib/RectangleUtils.h>
+
+#include "KernelCheck.h"
+
+namespace NVL_App
+{
+	class RegionSuite
+	{
+	public:
+		static void Run(KernelCheck& check, const Size& size, unsigned int seed);
+	private:
+		static void CheckQueries(KernelCheck& check, const string& label, Mat& image, vector<Rect>& regions);
+		static void CheckWindows(KernelCheck& check, Mat& mask);
+		static void TimeQueries(KernelCheck& check, Mat& depth, vector<Rect>& regions);
+		static Vec4d GetBruteForce(Mat& image, const Rect& region);
+		static vector<Rect> GetRegions(RNG& rng, const Size& size, int count);
+	};
+}
@@ -0,0 +1,102 @@
+//--------------------------------------------------
+// Startup code module
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <iostream>
+using namespace std;
+
+#include <NVLib/Parameters/Parameters.h>
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "ArgReader.h"
+#include "KernelCheck.h"
+#include "MaskSuite.h"
+#include "StringSuite.h"
+#include "RegionSuite.h"
+#include "RefinerSuite.h"
+
+//--------------------------------------------------
+// Function Prototypes
+//--------------------------------------------------
+bool Run(NVLib::Parameters * parameters);
+
+//--------------------------------------------------
+// Execution Logic
+//--------------------------------------------------
+
+/**
+ * Main entry point into the application
+ * @param parameters The input parameters
+ * @return true All the checks passed
+ * @return false At least one check failed
+ */
+bool Run(NVLib::Parameters * parameters) 
+{
+    // Verify that we have some input parameters
+    if (parameters == nullptr) return true;
+
+    auto suite = NVL_Utils::ArgReader::ReadString(parameters, "suite");
+    auto width = NVL_Utils::ArgReader::ReadInteger(parameters, "width");
+    auto height = NVL_Utils::ArgReader::ReadInteger(parameters, "height");
+    auto count = NVL_Utils::ArgReader::ReadInteger(parameters, "count");
+    auto repeats = NVL_Utils::ArgReader::ReadInteger(parameters, "repeats");
+    auto seed = (unsigned int) NVL_Utils::ArgReader::ReadInteger(parameters, "seed");
+
+    if (width <= 0 || height <= 0) throw runtime_error("The test image size must be positive");
+
+    auto check = NVL_App::KernelCheck(repeats); auto size = Size(width, height); auto found = false;
+
+    cout << "Kernel" << string(22, ' ') << "   reference          new   speed-up" << endl;
+
+    if (suite == "mask" || suite == "all") { NVL_App::MaskSuite::Run(check, size, seed); found = true; }
+    if (suite == "string" || suite == "all") { NVL_App::StringSuite::Run(check, count, seed); found = true; }
+    if (suite == "region" || suite == "all") { NVL_App::RegionSuite::Run(check, size, seed); found = true; }
+    if (suite == "refiner" || suite == "all") { NVL_App::RefinerSuite::Run(check, seed); found = true; }
+
+    if (!found) throw runtime_error("Unknown suite: " + suite);
+
+    check.PrintSummary();
+
+    return check.GetFailures().empty();
+}
+
+//--------------------------------------------------
+// Entry Point
+//--------------------------------------------------
+
+/**
+ * Main Method
+ * @param argc The count of the incoming arguments
+ * @param argv The number of incoming arguments
+ * @return SUCCESS and FAILURE
+ */
+int main(int argc, char ** argv) 
+{
+    NVLib::Parameters * parameters = nullptr; auto passed = true;
+
+    try
+    {
+        parameters = NVL_Utils::ArgReader::GetParameters(argc, argv);
+        passed = Run(parameters);
+    }
+    catch (runtime_error exception)
+    {
+        cerr << "Error: " << exception.what() << endl;
+        exit(EXIT_FAILURE);
+    }
+    catch (string exception)
+    {
+        cerr << "Error: " << exception << endl;
+        exit(EXIT_FAILURE);
+    }
+
+    if (parameters != nullptr) delete parameters;
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
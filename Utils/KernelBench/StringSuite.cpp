@@ -0,0 +1,128 @@
+//--------------------------------------------------
+// Implementation of class StringSuite
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "StringSuite.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Run
+//--------------------------------------------------
+
+/**
+ * @brief Check the conversions on random values, and then time them against the previous versions
+ * @param check The collector of the results
+ * @param count The number of values that are converted
+ * @param seed The seed used to generate the values
+ */
+void StringSuite::Run(KernelCheck& check, int count, unsigned int seed)
+{
+	if (count <= 0) throw runtime_error("At least one value is needed for the string checks");
+
+	auto rng = RNG(seed); auto integers = vector<int>(count); auto doubles = vector<double>(count);
+
+	// Values cover several orders of magnitude (and both signs) so that both fixed and scientific output is produced
+	for (auto i = 0; i < count; i++)
+	{
+		integers[i] = (int)rng.next();
+		doubles[i] = rng.uniform(-1.0, 1.0) * pow(10.0, rng.uniform(-12, 13));
+	}
+
+	CheckConversions(check, integers, doubles);
+	TimeConversions(check, integers, doubles);
+}
+
+//--------------------------------------------------
+// Checks
+//--------------------------------------------------
+
+/**
+ * @brief Compare every conversion with the previous version
+ * @param check The collector of the results
+ * @param integers The integer test values
+ * @param doubles The double test values
+ */
+void StringSuite::CheckConversions(KernelCheck& check, vector<int>& integers, vector<double>& doubles)
+{
+	auto intText = true; auto intValue = true; auto doubleText = true; auto doubleValue = true; auto exactValue = true;
+
+	for (auto value : integers)
+	{
+		auto text = ReferenceConversions::Int2String(value);
+		intText &= NVLib::StringUtils::Int2String(value) == text;
+		intValue &= NVLib::StringUtils::String2Int(text) == ReferenceConversions::String2Int(text);
+	}
+
+	for (auto value : doubles)
+	{
+		auto text = ReferenceConversions::Double2String(value);
+		doubleText &= NVLib::StringUtils::Double2String(value) == text;
+		doubleValue &= NVLib::StringUtils::String2Double(text) == ReferenceConversions::String2Double(text);
+	}
+
+	// Full precision text must round trip exactly
+	auto exact = GetExactText(doubles);
+	for (auto i = 0; i < (int)doubles.size(); i++) exactValue &= NVLib::StringUtils::String2Double(exact[i]) == doubles[i];
+
+	check.Verify("string/Int2String", intText);
+	check.Verify("string/String2Int", intValue);
+	check.Verify("string/Double2String", doubleText);
+	check.Verify("string/String2Double", doubleValue);
+	check.Verify("string/String2Double/round-trip", exactValue);
+
+	// Inputs that the previous version accepted as well
+	check.Compare("string/String2Int/padded", ReferenceConversions::String2Int("  +42"), NVLib::StringUtils::String2Int("  +42 "));
+	check.Compare("string/String2Double/padded", ReferenceConversions::String2Double(" -1.5e3"), NVLib::StringUtils::String2Double(" -1.5e3 "));
+}
+
+//--------------------------------------------------
+// Timing
+//--------------------------------------------------
+
+/**
+ * @brief Time each conversion against the previous version
+ * @param check The collector of the results
+ * @param integers The integer test values
+ * @param doubles The double test values
+ */
+void StringSuite::TimeConversions(KernelCheck& check, vector<int>& integers, vector<double>& doubles)
+{
+	auto intText = vector<string>(); for (auto value : integers) intText.push_back(ReferenceConversions::Int2String(value));
+	auto doubleText = GetExactText(doubles);
+
+	// The sums stop the conversions from being optimised away
+	auto sink = 0.0;
+
+	check.Report("Int2String", [&]() { for (auto value : integers) sink += ReferenceConversions::Int2String(value).size(); }, [&]() { for (auto value : integers) sink += NVLib::StringUtils::Int2String(value).size(); });
+	check.Report("String2Int", [&]() { for (auto& text : intText) sink += ReferenceConversions::String2Int(text); }, [&]() { for (auto& text : intText) sink += NVLib::StringUtils::String2Int(text); });
+	check.Report("Double2String", [&]() { for (auto value : doubles) sink += ReferenceConversions::Double2String(value).size(); }, [&]() { for (auto value : doubles) sink += NVLib::StringUtils::Double2String(value).size(); });
+	check.Report("String2Double", [&]() { for (auto& text : doubleText) sink += ReferenceConversions::String2Double(text); }, [&]() { for (auto& text : doubleText) sink += NVLib::StringUtils::String2Double(text); });
+
+	if (sink == 0.12345) cout << endl;
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Format values with enough digits to round trip
+ * @param values The values that we are formatting
+ * @return vector<string> The resultant text
+ */
+vector<string> StringSuite::GetExactText(vector<double>& values)
+{
+	auto result = vector<string>(); char buffer[32];
+
+	for (auto value : values)
+	{
+		snprintf(buffer, sizeof(buffer), "%.17g", value);
+		result.push_back(buffer);
+	}
+
+	return result;
+}
@@ -0,0 +1,35 @@
+//--------------------------------------------------
+// Verifies the StringUtils numeric conversions against the previous stringstream versions
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cstdio>
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/StringUtils.h>
+
+#include "KernelCheck.h"
+#include "ReferenceConversions.h"
+
+namespace NVL_App
+{
+	class StringSuite
+	{
+	public:
+		static void Run(KernelCheck& check, int count, unsigned int seed);
+	private:
+		static void CheckConversions(KernelCheck& check, vector<int>& integers, vector<double>& doubles);
+		static void TimeConversions(KernelCheck& check, vector<int>& integers, vector<double>& doubles);
+		static vector<string> GetExactText(vector<double>& values);
+	};
+}
@@ -0,0 +1,84 @@
+//--------------------------------------------------
+// Implementation of class BenchReport
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "BenchReport.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Entries
+//--------------------------------------------------
+
+/**
+ * @brief Add a text value to the report
+ * @param key The key of the value
+ * @param value The value that we are adding
+ */
+void BenchReport::AddText(const string& key, const string& value)
+{
+	_entries.push_back(make_pair(key, "\"" + NVLib::EscapeUtils::JsonEscape(value) + "\""));
+}
+
+/**
+ * @brief Add a numeric value to the report
+ * @param key The key of the value
+ * @param value The value that we are adding
+ */
+void BenchReport::AddNumber(const string& key, double value)
+{
+	_entries.push_back(make_pair(key, NVLib::EscapeUtils::JsonNumber(value)));
+}
+
+/**
+ * @brief Add the mean time of a tracker stage to the report
+ * @param stage The name of the stage
+ * @param milliseconds The mean time per frame in milliseconds
+ */
+void BenchReport::AddStage(const string& stage, double milliseconds)
+{
+	_stages.push_back(make_pair(stage, milliseconds));
+}
+
+//--------------------------------------------------
+// Output
+//--------------------------------------------------
+
+/**
+ * @brief Render the report as JSON
+ * @return string The resultant JSON
+ */
+string BenchReport::GetJson()
+{
+	auto writer = stringstream();
+
+	writer << "{" << endl;
+
+	for (auto& entry : _entries) writer << "  \"" << NVLib::EscapeUtils::JsonEscape(entry.first) << "\": " << entry.second << "," << endl;
+
+	writer << "  \"stages_ms\": {";
+	for (auto i = 0; i < (int)_stages.size(); i++)
+	{
+		writer << (i == 0 ? "" : ",") << endl << "    \"" << NVLib::EscapeUtils::JsonEscape(_stages[i].first) << "\": " << NVLib::EscapeUtils::JsonNumber(_stages[i].second);
+	}
+	writer << (_stages.empty() ? "" : "\n  ") << "}" << endl;
+
+	writer << "}" << endl;
+
+	return writer.str();
+}
+
+/**
+ * @brief Save the report to disk
+ * @param path The path that we are saving to
+ */
+void BenchReport::Save(const string& path)
+{
+	auto writer = ofstream(path);
+	if (!writer.is_open()) throw runtime_error("Unable to open: " + path);
+	writer << GetJson();
+	writer.close();
+}
@@ -0,0 +1,39 @@
+//--------------------------------------------------
+// Collects the results of a benchmark run and writes them as JSON
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+using namespace std;
+
+#include <NVLib/EscapeUtils.h>
+
+namespace NVL_App
+{
+	class BenchReport
+	{
+	private:
+		vector<pair<string, string>> _entries;
+		vector<pair<string, double>> _stages;
+	public:
+		BenchReport() {}
+
+		void AddText(const string& key, const string& value);
+		void AddNumber(const string& key, double value);
+		void AddStage(const string& stage, double milliseconds);
+
+		string GetJson();
+		void Save(const string& path);
+
+		inline vector<pair<string, string>>& GetEntries() { return _entries; }
+		inline vector<pair<string, double>>& GetStages() { return _stages; }
+	};
+}
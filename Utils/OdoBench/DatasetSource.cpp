@@ -0,0 +1,117 @@
+//--------------------------------------------------
+// Implementation of class DatasetSource
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "DatasetSource.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Constructors
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param database The folder containing the datasets
+ * @param dataset The name of the dataset that we are replaying
+ * @param maxFrames The maximum number of frames that we are loading
+ * @param depthScale The scale that converts the dataset units into millimeters
+ */
+DatasetSource::DatasetSource(const string& database, const string& dataset, int maxFrames, double depthScale) : _depthScale(depthScale)
+{
+	_folder = NVLib::FileUtils::PathCombine(database, dataset);
+	_camera = LoadCameraMatrix();
+
+	// The dataset stores camera to world poses, so they are inverted to get world to camera
+	for (auto index = 0; index < maxFrames; index++)
+	{
+		if (!NVLib::FileUtils::Exists(GetFramePath("color_", index, ".png"))) break;
+
+		Mat pose = LoadPose(index); if (pose.empty()) break;
+		_poses.push_back(pose.inv());
+	}
+
+	if (_poses.size() < 2) throw runtime_error("At least 2 frames with poses are required from: " + _folder);
+}
+
+//--------------------------------------------------
+// Frame Retrieval
+//--------------------------------------------------
+
+/**
+ * @brief Load the frame at the given index
+ * @param index The index of the frame
+ * @return NVLib::DepthFrame * The loaded frame
+ */
+NVLib::DepthFrame * DatasetSource::GetFrame(int index)
+{
+	auto colorPath = GetFramePath("color_", index, ".png");
+	auto depthPath = GetFramePath("depth_", index, ".tiff");
+
+	Mat color = imread(colorPath); if (color.empty()) throw runtime_error("Unable to load: " + colorPath);
+	Mat depth = imread(depthPath, IMREAD_UNCHANGED); if (depth.empty()) throw runtime_error("Unable to load: " + depthPath);
+
+	Mat depth32; depth.convertTo(depth32, CV_32F, _depthScale);
+
+	return new NVLib::DepthFrame(color, depth32);
+}
+
+//--------------------------------------------------
+// Loaders
+//--------------------------------------------------
+
+/**
+ * @brief Load the camera matrix of the dataset
+ * @return Mat The camera matrix that has been loaded
+ */
+Mat DatasetSource::LoadCameraMatrix()
+{
+	auto path = NVLib::FileUtils::PathCombine(NVLib::FileUtils::PathCombine(_folder, "meta"), "calibration.xml");
+
+	auto reader = FileStorage(path, FileStorage::FORMAT_XML | FileStorage::READ);
+	Mat camera; reader["camera"] >> camera;
+	if (camera.empty()) throw runtime_error("Failed to load the camera matrix from: " + path);
+	reader.release();
+
+	return camera;
+}
+
+/**
+ * @brief Load the pose of a given frame (with the translation scaled into millimeters)
+ * @param index The index of the pose that we want
+ * @return Mat The pose matrix (empty if it was not found)
+ */
+Mat DatasetSource::LoadPose(int index)
+{
+	auto filename = stringstream(); filename << "pose_" << setw(4) << setfill('0') << index << ".xml";
+	auto path = NVLib::FileUtils::PathCombine(NVLib::FileUtils::PathCombine(_folder, "pose"), filename.str());
+
+	auto reader = FileStorage(path, FileStorage::FORMAT_XML | FileStorage::READ);
+	if (!reader.isOpened()) return Mat();
+	Mat pose; reader["pose"] >> pose;
+	reader.release();
+
+	if (pose.empty()) return pose;
+
+	pose.convertTo(pose, CV_64F);
+	auto data = (double *) pose.data;
+	data[3] *= _depthScale; data[7] *= _depthScale; data[11] *= _depthScale;
+
+	return pose;
+}
+
+/**
+ * @brief Build the path to a raw frame file
+ * @param prefix The prefix of the file name
+ * @param index The index of the frame
+ * @param extension The extension of the file
+ * @return string The resultant path
+ */
+string DatasetSource::GetFramePath(const string& prefix, int index, const string& extension)
+{
+	auto filename = stringstream(); filename << prefix << setw(4) << setfill('0') << index << extension;
+	return NVLib::FileUtils::PathCombine(NVLib::FileUtils::PathCombine(_folder, "raw"), filename.str());
+}
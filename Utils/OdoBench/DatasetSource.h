@@ -0,0 +1,45 @@
+//--------------------------------------------------
+// Replays an imported dataset (raw frames, calibration and poses) as a frame source
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/FileUtils.h>
+
+#include "FrameSource.h"
+
+namespace NVL_App
+{
+	class DatasetSource : public FrameSource
+	{
+	private:
+		string _folder;
+		double _depthScale;
+		Mat _camera;
+		vector<Mat> _poses;
+	public:
+		DatasetSource(const string& database, const string& dataset, int maxFrames, double depthScale);
+
+		Mat& GetCamera() override { return _camera; }
+		int GetFrameCount() override { return (int)_poses.size(); }
+		NVLib::DepthFrame * GetFrame(int index) override;
+		Mat GetTruth(int index) override { return _poses[index].clone(); }
+		string GetName() override { return "dataset"; }
+
+		inline string& GetFolder() { return _folder; }
+	private:
+		Mat LoadCameraMatrix();
+		Mat LoadPose(int index);
+		string GetFramePath(const string& prefix, int index, const string& extension);
+	};
+}
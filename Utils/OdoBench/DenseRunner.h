@@ -0,0 +1,69 @@
+//--------------------------------------------------
+// Drives a dense tracker (IcpTracker or PhotoTracker) through a sequence
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "TrackerRunner.h"
+
+namespace NVL_App
+{
+	template <typename T>
+	class DenseRunner : public TrackerRunner
+	{
+	private:
+		T * _tracker;
+		string _name;
+	public:
+
+		/**
+		 * @brief Main Constructor
+		 * @param name The name of the tracker
+		 * @param camera The camera matrix of the sequence
+		 * @param firstFrame The first frame (the runner takes ownership)
+		 */
+		DenseRunner(const string& name, Mat& camera, NVLib::DepthFrame * firstFrame) : _name(name)
+		{
+			_tracker = new T(camera, firstFrame);
+		}
+
+		/**
+		 * @brief Main Terminator
+		 */
+		~DenseRunner()
+		{
+			delete _tracker->GetFrame(); delete _tracker;
+		}
+
+		/**
+		 * @brief Track the next frame
+		 * @param frame The frame that we are tracking
+		 * @param error The output residual error
+		 * @return Mat The relative pose
+		 */
+		Mat Track(NVLib::DepthFrame * frame, Vec2d& error) override
+		{
+			auto ticks = getTickCount();
+			Mat pose = _tracker->GetPose(frame, error);
+			_timings.Record("align", ticks);
+
+			ticks = getTickCount();
+			_tracker->UpdateNextFrame(frame, true);
+			_timings.Record("update", ticks);
+
+			return pose;
+		}
+
+		string GetName() override { return _name; }
+	};
+}
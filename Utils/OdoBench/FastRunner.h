@@ -0,0 +1,73 @@
+//--------------------------------------------------
+// Drives the feature based tracker (FastTracker) through a sequence
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/Odometry/FastTracker.h>
+
+#include "TrackerRunner.h"
+
+namespace NVL_App
+{
+	class FastRunner : public TrackerRunner
+	{
+	private:
+		NVLib::FastTracker * _tracker;
+		bool _keyframeMode;
+	public:
+
+		/**
+		 * @brief Main Constructor
+		 * @param camera The camera matrix of the sequence
+		 * @param firstFrame The first frame (the runner takes ownership)
+		 * @param keyframeMode Indicates whether the tracker runs against keyframes
+		 */
+		FastRunner(Mat& camera, NVLib::DepthFrame * firstFrame, bool keyframeMode) : _keyframeMode(keyframeMode)
+		{
+			_tracker = new NVLib::FastTracker(camera, firstFrame, keyframeMode);
+			_tracker->SetTimings(&_timings);
+		}
+
+		/**
+		 * @brief Main Terminator
+		 */
+		~FastRunner()
+		{
+			delete _tracker->GetFrame(); delete _tracker;
+		}
+
+		/**
+		 * @brief Track the next frame
+		 * @param frame The frame that we are tracking
+		 * @param error The output reprojection error
+		 * @return Mat The relative pose (empty if there were not enough matches or the pose solve failed)
+		 */
+		Mat Track(NVLib::DepthFrame * frame, Vec2d& error) override
+		{
+			Mat pose; auto keypoints = vector<KeyPoint>();
+
+			// A failed frame is dropped, so the next frame is still tracked against the current reference
+			try { pose = _tracker->GetPose(frame, keypoints, error); }
+			catch (cv::Exception&) { delete frame; return Mat(); }
+
+			auto ticks = getTickCount();
+			_tracker->UpdateNextFrame(frame, keypoints, true);
+			_timings.Record("update", ticks);
+
+			return pose;
+		}
+
+		string GetName() override { return _keyframeMode ? "keyframe" : "fast"; }
+	};
+}
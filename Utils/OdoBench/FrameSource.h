@@ -0,0 +1,58 @@
+//--------------------------------------------------
+// Defines a source of RGB-D frames with ground truth poses
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/Model/DepthFrame.h>
+
+namespace NVL_App
+{
+	class FrameSource
+	{
+	public:
+		virtual ~FrameSource() {}
+
+		/**
+		 * @brief Retrieve the camera matrix of the sequence
+		 * @return Mat& The camera matrix
+		 */
+		virtual Mat& GetCamera() = 0;
+
+		/**
+		 * @brief Retrieve the number of frames within the sequence
+		 * @return int The frame count
+		 */
+		virtual int GetFrameCount() = 0;
+
+		/**
+		 * @brief Create the frame at the given index (the caller takes ownership)
+		 * @param index The index of the frame
+		 * @return NVLib::DepthFrame * The frame (depth is CV_32F in millimeters)
+		 */
+		virtual NVLib::DepthFrame * GetFrame(int index) = 0;
+
+		/**
+		 * @brief Retrieve the ground truth pose of a frame
+		 * @param index The index of the frame
+		 * @return Mat The pose that maps world points into the camera
+		 */
+		virtual Mat GetTruth(int index) = 0;
+
+		/**
+		 * @brief Retrieve the name of the source (for reporting)
+		 * @return string The name of the source
+		 */
+		virtual string GetName() = 0;
+	};
+}
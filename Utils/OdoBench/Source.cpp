@@ -0,0 +1,194 @@
+//--------------------------------------------------
+// Startup code module
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <iostream>
+using namespace std;
+
+#include <NVLib/Logger.h>
+#include <NVLib/Odometry/IcpTracker.h>
+#include <NVLib/Odometry/PhotoTracker.h>
+#include <NVLib/Parameters/Parameters.h>
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "ArgReader.h"
+#include "FrameSource.h"
+#include "SyntheticSource.h"
+#include "DatasetSource.h"
+#include "TrackerRunner.h"
+#include "FastRunner.h"
+#include "DenseRunner.h"
+#include "TrajectoryMetrics.h"
+#include "BenchReport.h"
+
+//--------------------------------------------------
+// Function Prototypes
+//--------------------------------------------------
+void Run(NVLib::Parameters * parameters);
+unique_ptr<NVL_App::FrameSource> CreateSource(NVLib::Parameters * parameters);
+unique_ptr<NVL_App::TrackerRunner> CreateRunner(const string& tracker, Mat& camera, NVLib::DepthFrame * firstFrame);
+
+//--------------------------------------------------
+// Execution Logic
+//--------------------------------------------------
+
+/**
+ * Main entry point into the application
+ * @param parameters The input parameters
+ */
+void Run(NVLib::Parameters * parameters) 
+{
+    // Verify that we have some input parameters
+    if (parameters == nullptr) return; auto logger = NVLib::Logger(1);
+
+    logger.StartApplication();
+
+    NVLIB_LOG(logger, 1, "Creating the frame source");
+    auto source = CreateSource(parameters);
+    auto frameCount = source->GetFrameCount();
+    NVLIB_LOG(logger, 1, "Source: %s (%i frames)", source->GetName().c_str(), frameCount);
+
+    NVLIB_LOG(logger, 1, "Creating the tracker");
+    auto trackerName = NVL_Utils::ArgReader::ReadString(parameters, "tracker");
+    auto runner = CreateRunner(trackerName, source->GetCamera(), source->GetFrame(0));
+
+    // The estimated trajectory is anchored at the first ground truth pose
+    auto truth = vector<Mat>(); auto estimate = vector<Mat>();
+    truth.push_back(source->GetTruth(0)); estimate.push_back(source->GetTruth(0));
+
+    NVLIB_LOG(logger, 1, "Tracking the sequence");
+    auto stageTotals = map<string, double>(); auto trackTime = 0.0; auto failures = 0;
+
+    for (auto index = 1; index < frameCount; index++)
+    {
+        // Frame loading (or rendering) is excluded from the timings
+        auto frame = source->GetFrame(index);
+
+        runner->GetTimings().Clear();
+        auto error = Vec2d(); auto ticks = getTickCount();
+        Mat pose = runner->Track(frame, error);
+        trackTime += (getTickCount() - ticks) / getTickFrequency();
+
+        for (auto& stage : runner->GetTimings().GetTotals()) stageTotals[stage.first] += stage.second;
+
+        if (pose.empty()) { failures++; pose = Mat_<double>::eye(4,4); }
+
+        truth.push_back(source->GetTruth(index));
+        estimate.push_back(pose * estimate[index - 1]);
+
+        NVLIB_LOG(logger, 2, "Frame %i: error = %f", index, error[0]);
+    }
+
+    NVLIB_LOG(logger, 1, "Calculating the metrics");
+    auto trackedFrames = frameCount - 1;
+    auto ate = NVL_App::TrajectoryMetrics::GetATE(truth, estimate);
+    auto rpe = NVL_App::TrajectoryMetrics::GetRPE(truth, estimate);
+    auto fps = trackTime > 0 ? trackedFrames / trackTime : 0;
+    NVLIB_LOG(logger, 1, "FPS: %f, ATE: %f, RPE: %f (%f deg)", fps, ate, rpe[0], rpe[1]);
+
+    NVLIB_LOG(logger, 1, "Writing the report");
+    auto report = NVL_App::BenchReport();
+    report.AddText("source", source->GetName());
+    report.AddText("tracker", runner->GetName());
+    report.AddNumber("seed", NVL_Utils::ArgReader::ReadInteger(parameters, "seed"));
+    report.AddNumber("frames", frameCount);
+    report.AddNumber("failures", failures);
+    report.AddNumber("track_seconds", trackTime);
+    report.AddNumber("fps", fps);
+    report.AddNumber("ate_rmse", ate);
+    report.AddNumber("rpe_translation_rmse", rpe[0]);
+    report.AddNumber("rpe_rotation_rmse_deg", rpe[1]);
+    for (auto& stage : stageTotals) report.AddStage(stage.first, 1000.0 * stage.second / trackedFrames);
+    report.Save(NVL_Utils::ArgReader::ReadString(parameters, "output"));
+
+    logger.StopApplication();
+}
+
+//--------------------------------------------------
+// Factories
+//--------------------------------------------------
+
+/**
+ * @brief Create the source of the frames
+ * @param parameters The input parameters
+ * @return unique_ptr<NVL_App::FrameSource> The resultant source
+ */
+unique_ptr<NVL_App::FrameSource> CreateSource(NVLib::Parameters * parameters) 
+{
+    auto source = NVL_Utils::ArgReader::ReadString(parameters, "source");
+    auto frames = NVL_Utils::ArgReader::ReadInteger(parameters, "frames");
+
+    if (source == "synthetic") 
+    {
+        auto seed = NVL_Utils::ArgReader::ReadInteger(parameters, "seed");
+        return unique_ptr<NVL_App::FrameSource>(new NVL_App::SyntheticSource(frames, (unsigned int) seed));
+    }
+    else if (source == "dataset") 
+    {
+        auto database = NVL_Utils::ArgReader::ReadString(parameters, "database");
+        auto dataset = NVL_Utils::ArgReader::ReadString(parameters, "dataset");
+        auto depthScale = NVL_Utils::ArgReader::ReadDouble(parameters, "depth_scale");
+        return unique_ptr<NVL_App::FrameSource>(new NVL_App::DatasetSource(database, dataset, frames, depthScale));
+    }
+
+    throw runtime_error("Unknown frame source: " + source);
+}
+
+/**
+ * @brief Create the runner for the requested tracker
+ * @param tracker The name of the tracker
+ * @param camera The camera matrix of the sequence
+ * @param firstFrame The first frame of the sequence
+ * @return unique_ptr<NVL_App::TrackerRunner> The resultant runner
+ */
+unique_ptr<NVL_App::TrackerRunner> CreateRunner(const string& tracker, Mat& camera, NVLib::DepthFrame * firstFrame) 
+{
+    if (tracker == "fast") return unique_ptr<NVL_App::TrackerRunner>(new NVL_App::FastRunner(camera, firstFrame, false));
+    if (tracker == "keyframe") return unique_ptr<NVL_App::TrackerRunner>(new NVL_App::FastRunner(camera, firstFrame, true));
+    if (tracker == "icp") return unique_ptr<NVL_App::TrackerRunner>(new NVL_App::DenseRunner<NVLib::IcpTracker>(tracker, camera, firstFrame));
+    if (tracker == "photo") return unique_ptr<NVL_App::TrackerRunner>(new NVL_App::DenseRunner<NVLib::PhotoTracker>(tracker, camera, firstFrame));
+
+    delete firstFrame;
+    throw runtime_error("Unknown tracker: " + tracker);
+}
+
+//--------------------------------------------------
+// Entry Point
+//--------------------------------------------------
+
+/**
+ * Main Method
+ * @param argc The count of the incoming arguments
+ * @param argv The number of incoming arguments
+ * @return SUCCESS and FAILURE
+ */
+int main(int argc, char ** argv) 
+{
+    NVLib::Parameters * parameters = nullptr;
+
+    try
+    {
+        parameters = NVL_Utils::ArgReader::GetParameters(argc, argv);
+        Run(parameters);
+    }
+    catch (runtime_error exception)
+    {
+        cerr << "Error: " << exception.what() << endl;
+        exit(EXIT_FAILURE);
+    }
+    catch (string exception)
+    {
+        cerr << "Error: " << exception << endl;
+        exit(EXIT_FAILURE);
+    }
+
+    if (parameters != nullptr) delete parameters;
+
+    return EXIT_SUCCESS;
+}
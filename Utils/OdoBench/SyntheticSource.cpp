@@ -0,0 +1,122 @@
+//--------------------------------------------------
+// Implementation of class SyntheticSource
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "SyntheticSource.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Constructors
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param frameCount The number of frames within the sequence
+ * @param seed The seed that makes the sequence repeatable
+ * @param imageSize The size of the rendered images
+ */
+SyntheticSource::SyntheticSource(int frameCount, unsigned int seed, const Size& imageSize) : _seed(seed)
+{
+	if (frameCount < 2) throw runtime_error("A synthetic sequence requires at least 2 frames");
+
+	NVLib::RandomUtils::Seed(seed);
+
+	_camera = NVLib::RandomUtils::GetKMatrix(NVLib::Range<double>(500, 600), imageSize, NVLib::Range<double>(-10, 10), true);
+
+	BuildScene(imageSize);
+	BuildTrajectory(frameCount);
+}
+
+//--------------------------------------------------
+// Frame Retrieval
+//--------------------------------------------------
+
+/**
+ * @brief Render the frame at the given index
+ * @param index The index of the frame
+ * @return NVLib::DepthFrame * The rendered frame
+ */
+NVLib::DepthFrame * SyntheticSource::GetFrame(int index)
+{
+	if (index < 0 || index >= (int)_poses.size()) throw runtime_error("Synthetic frame index out of range");
+
+	Mat depth; Mat color = NVLib::CloudUtils::RenderImage(_cloud, _camera, _poses[index], depth);
+
+	// Forward rendering leaves single pixel cracks, so fill them from their neighbours
+	Mat holes = depth == 0; Mat filledColor, filledDepth;
+	dilate(color, filledColor, Mat()); dilate(depth, filledDepth, Mat());
+	filledColor.copyTo(color, holes); filledDepth.copyTo(depth, holes);
+
+	Mat depth32; depth.convertTo(depth32, CV_32F);
+
+	return new NVLib::DepthFrame(color, depth32);
+}
+
+//--------------------------------------------------
+// Generation
+//--------------------------------------------------
+
+/**
+ * @brief Build a textured scene as a color cloud in the frame of the first camera
+ * @param imageSize The size of the image that the scene is built from
+ * @remark The scene is a slanted back wall with a few boxes in front of it (depths in millimeters)
+ */
+void SyntheticSource::BuildScene(const Size& imageSize)
+{
+	auto rng = RNG(_seed);
+
+	// Create a texture with plenty of corners for the feature trackers
+	Mat color = Mat_<Vec3b>(imageSize); rng.fill(color, RNG::UNIFORM, 0, 255);
+	GaussianBlur(color, color, Size(5, 5), 0);
+
+	for (auto i = 0; i < 150; i++)
+	{
+		auto point = Point(rng.uniform(0, imageSize.width), rng.uniform(0, imageSize.height));
+		auto size = Size(rng.uniform(5, 40), rng.uniform(5, 40));
+		auto shade = Scalar(rng.uniform(0, 255), rng.uniform(0, 255), rng.uniform(0, 255));
+		rectangle(color, Rect(point, size), shade, FILLED);
+	}
+
+	// Create the depth as a slanted wall
+	Mat depth = Mat_<double>(imageSize);
+	auto slope = rng.uniform(-0.4, 0.4);
+
+	for (auto row = 0; row < imageSize.height; row++)
+	{
+		auto output = depth.ptr<double>(row);
+		for (auto column = 0; column < imageSize.width; column++) output[column] = 1500 + slope * (column - imageSize.width * 0.5);
+	}
+
+	// Add some boxes in front of the wall
+	for (auto i = 0; i < 4; i++)
+	{
+		auto point = Point(rng.uniform(0, imageSize.width - 100), rng.uniform(0, imageSize.height - 100));
+		auto box = Rect(point, Size(rng.uniform(50, 100), rng.uniform(50, 100)));
+		depth(box).setTo(rng.uniform(800.0, 1200.0));
+	}
+
+	_cloud = NVLib::CloudUtils::BuildColorCloud(_camera, color, depth);
+}
+
+/**
+ * @brief Generate a smooth random trajectory
+ * @param frameCount The number of poses that we are generating
+ * @remark Each step is a small random motion composed onto the previous pose (world to camera)
+ */
+void SyntheticSource::BuildTrajectory(int frameCount)
+{
+	_poses.clear(); _poses.push_back(Mat_<double>::eye(4,4));
+
+	auto rotation = NVLib::Range<double>(-0.3, 0.3);
+	auto translation = NVLib::Range<double>(-5, 5);
+
+	for (auto i = 1; i < frameCount; i++)
+	{
+		Mat step = NVLib::RandomUtils::GetPoseMatrix(rotation, rotation, rotation, translation, translation, translation);
+		_poses.push_back(step * _poses[i - 1]);
+	}
+}
@@ -0,0 +1,47 @@
+//--------------------------------------------------
+// Generates a deterministic synthetic RGB-D sequence from a random scene and trajectory
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/CloudUtils.h>
+#include <NVLib/RandomUtils.h>
+#include <NVLib/Model/Range.h>
+
+#include "FrameSource.h"
+
+namespace NVL_App
+{
+	class SyntheticSource : public FrameSource
+	{
+	private:
+		Mat _camera;
+		Mat _cloud;
+		vector<Mat> _poses;
+		unsigned int _seed;
+	public:
+		SyntheticSource(int frameCount, unsigned int seed, const Size& imageSize = Size(640, 480));
+
+		Mat& GetCamera() override { return _camera; }
+		int GetFrameCount() override { return (int)_poses.size(); }
+		NVLib::DepthFrame * GetFrame(int index) override;
+		Mat GetTruth(int index) override { return _poses[index].clone(); }
+		string GetName() override { return "synthetic"; }
+
+		inline Mat& GetCloud() { return _cloud; }
+		inline unsigned int GetSeed() { return _seed; }
+	private:
+		void BuildScene(const Size& imageSize);
+		void BuildTrajectory(int frameCount);
+	};
+}
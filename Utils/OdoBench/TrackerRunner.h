@@ -0,0 +1,45 @@
+//--------------------------------------------------
+// Defines a common interface for driving a tracker through a sequence
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/Model/DepthFrame.h>
+#include <NVLib/Odometry/TrackerTimings.h>
+
+namespace NVL_App
+{
+	class TrackerRunner
+	{
+	protected:
+		NVLib::TrackerTimings _timings;
+	public:
+		virtual ~TrackerRunner() {}
+
+		/**
+		 * @brief Track the next frame (the runner takes ownership of the frame)
+		 * @param frame The frame that we are tracking
+		 * @param error The output error of the tracker
+		 * @return Mat The pose mapping points in the previous frame into this frame (empty on failure)
+		 */
+		virtual Mat Track(NVLib::DepthFrame * frame, Vec2d& error) = 0;
+
+		/**
+		 * @brief Retrieve the name of the tracker (for reporting)
+		 * @return string The name of the tracker
+		 */
+		virtual string GetName() = 0;
+
+		inline NVLib::TrackerTimings& GetTimings() { return _timings; }
+	};
+}
@@ -0,0 +1,104 @@
+//--------------------------------------------------
+// Implementation of class TrajectoryMetrics
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "TrajectoryMetrics.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Absolute Trajectory Error
+//--------------------------------------------------
+
+/**
+ * @brief Calculate the absolute trajectory error (RMSE of the camera centres)
+ * @param truth The ground truth poses (world to camera)
+ * @param estimate The estimated poses (world to camera)
+ * @return double The RMSE of the distances between the camera centres
+ * @remark The estimate is expected to start at the first truth pose, so no alignment is performed
+ */
+double TrajectoryMetrics::GetATE(vector<Mat>& truth, vector<Mat>& estimate)
+{
+	if (truth.size() != estimate.size()) throw runtime_error("Trajectory sizes do not match");
+	if (truth.empty()) return 0;
+
+	auto total = 0.0;
+
+	for (auto i = 0; i < (int)truth.size(); i++)
+	{
+		auto difference = GetCentre(truth[i]) - GetCentre(estimate[i]);
+		total += difference.dot(difference);
+	}
+
+	return sqrt(total / truth.size());
+}
+
+//--------------------------------------------------
+// Relative Pose Error
+//--------------------------------------------------
+
+/**
+ * @brief Calculate the relative pose error between consecutive frames
+ * @param truth The ground truth poses (world to camera)
+ * @param estimate The estimated poses (world to camera)
+ * @return Vec2d The RMSE of the translation error and the RMSE of the rotation error (degrees)
+ */
+Vec2d TrajectoryMetrics::GetRPE(vector<Mat>& truth, vector<Mat>& estimate)
+{
+	if (truth.size() != estimate.size()) throw runtime_error("Trajectory sizes do not match");
+	if (truth.size() < 2) return Vec2d(0, 0);
+
+	auto translationTotal = 0.0; auto rotationTotal = 0.0;
+
+	for (auto i = 1; i < (int)truth.size(); i++)
+	{
+		Mat truthStep = truth[i] * truth[i - 1].inv();
+		Mat estimateStep = estimate[i] * estimate[i - 1].inv();
+		Mat error = truthStep.inv() * estimateStep;
+
+		auto data = (double *) error.data;
+		translationTotal += data[3] * data[3] + data[7] * data[7] + data[11] * data[11];
+
+		Mat rotation = error(Rect(0, 0, 3, 3));
+		auto angle = GetAngle(rotation);
+		rotationTotal += angle * angle;
+	}
+
+	auto count = truth.size() - 1;
+	return Vec2d(sqrt(translationTotal / count), sqrt(rotationTotal / count));
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Find the centre of a camera from its pose
+ * @param pose The pose (world to camera)
+ * @return Point3d The camera centre in world coordinates
+ */
+Point3d TrajectoryMetrics::GetCentre(Mat& pose)
+{
+	auto data = (double *) pose.data;
+
+	auto x = -(data[0] * data[3] + data[4] * data[7] + data[8] * data[11]);
+	auto y = -(data[1] * data[3] + data[5] * data[7] + data[9] * data[11]);
+	auto z = -(data[2] * data[3] + data[6] * data[7] + data[10] * data[11]);
+
+	return Point3d(x, y, z);
+}
+
+/**
+ * @brief Find the angle of a rotation matrix
+ * @param rotation The rotation matrix (3x3 view into a pose)
+ * @return double The angle in degrees
+ */
+double TrajectoryMetrics::GetAngle(Mat& rotation)
+{
+	auto trace = rotation.at<double>(0, 0) + rotation.at<double>(1, 1) + rotation.at<double>(2, 2);
+	auto cosine = std::min(1.0, std::max(-1.0, (trace - 1) * 0.5));
+	return acos(cosine) * 180.0 / CV_PI;
+}
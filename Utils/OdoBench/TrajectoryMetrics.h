@@ -0,0 +1,27 @@
+//--------------------------------------------------
+// Error metrics for comparing an estimated trajectory against ground truth
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVL_App
+{
+	class TrajectoryMetrics
+	{
+	public:
+		static double GetATE(vector<Mat>& truth, vector<Mat>& estimate);
+		static Vec2d GetRPE(vector<Mat>& truth, vector<Mat>& estimate);
+		static Point3d GetCentre(Mat& pose);
+		static double GetAngle(Mat& rotation);
+	};
+}